@@ -17,7 +17,8 @@ public class MyShooter : ModuleRules
                 "Niagara",
                 "PhysicsCore",
                 "GameplayTasks",
-                "NavigationSystem"
+                "NavigationSystem",
+                "UMG"
             }
         );
 
@@ -2,5 +2,22 @@
 
 #include "MyShooter.h"
 #include "Modules/ModuleManager.h"
+#include "Misc/CommandLine.h"
+#include "Dev/MSAllocationCounter.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, MyShooter, "MyShooter" );
+class FMyShooterModule : public FDefaultGameModuleImpl
+{
+public:
+    virtual void StartupModule() override
+    {
+#if !UE_BUILD_SHIPPING
+        // Allocator is wrapped as early as game code runs, not while the match is already playing
+        if (FParse::Param(FCommandLine::Get(), TEXT("MSCountAllocations")))
+        {
+            FMSAllocationCounter::Install();
+        }
+#endif
+    }
+};
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FMyShooterModule, MyShooter, "MyShooter" );
@@ -3,13 +3,13 @@
 #include "AI/Decorators/MSNeedAmmoDecorator.h"
 #include "AIController.h"
 #include "Components/MSWeaponComponent.h"
-#include "Core/CoreUtils.h"
+#include "Core/MSComponentRegistry.h"
 
 bool UMSNeedAmmoDecorator::CalculateRawConditionValue(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) const
 {
     if (const AAIController* Controller = OwnerComp.GetAIOwner())
     {
-        if (const auto WeaponComponent = FCoreUtils::GetActorComponent<UMSWeaponComponent>(Controller->GetPawn()))
+        if (const auto WeaponComponent = FMSComponentRegistry::GetComponent<UMSWeaponComponent>(Controller->GetPawn()))
         {
             FAmmoData CurrentAmmo, DefaultAmmo;
             WeaponComponent->GetWeaponAmmoData(WeaponClass, CurrentAmmo, DefaultAmmo);
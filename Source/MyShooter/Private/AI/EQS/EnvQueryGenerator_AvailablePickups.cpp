@@ -0,0 +1,40 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "AI/EQS/EnvQueryGenerator_AvailablePickups.h"
+#include "EnvironmentQuery/Items/EnvQueryItemType_Actor.h"
+#include "Pickups/MSPickup.h"
+#include "Pickups/MSPickupSubsystem.h"
+
+#define LOCTEXT_NAMESPACE "EnvQueryGenerator"
+
+UEnvQueryGenerator_AvailablePickups::UEnvQueryGenerator_AvailablePickups(const FObjectInitializer& ObjInit) : Super(ObjInit)
+{
+    ItemType = UEnvQueryItemType_Actor::StaticClass();
+    PickupClass = AMSPickup::StaticClass();
+}
+
+void UEnvQueryGenerator_AvailablePickups::GenerateItems(FEnvQueryInstance& QueryInstance) const
+{
+    const UWorld* World = QueryInstance.World;
+    const auto PickupSubsystem = World ? World->GetSubsystem<UMSPickupSubsystem>() : nullptr;
+    if (!PickupSubsystem || !PickupClass)
+    {
+        return;
+    }
+
+    PickupSubsystem->ForEachAvailablePickup(PickupClass, [&QueryInstance](AMSPickup* Pickup) { //
+        QueryInstance.AddItemData<UEnvQueryItemType_Actor>(Pickup);
+    });
+}
+
+FText UEnvQueryGenerator_AvailablePickups::GetDescriptionTitle() const
+{
+    return FText::Format(LOCTEXT("AvailablePickupsTitle", "Available {0}"), FText::FromString(GetNameSafe(PickupClass)));
+}
+
+FText UEnvQueryGenerator_AvailablePickups::GetDescriptionDetails() const
+{
+    return LOCTEXT("AvailablePickupsDetails", "only pickups which can be taken now");
+}
+
+#undef LOCTEXT_NAMESPACE
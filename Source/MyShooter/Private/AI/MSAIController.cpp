@@ -4,6 +4,8 @@
 #include "AI/MSAICharacter.h"
 #include "Components/MSAIPerceptionComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
+#include "BrainComponent.h"
+#include "Dev/MSReplaySubsystem.h"
 
 AMSAIController::AMSAIController()
 {
@@ -17,19 +19,51 @@ void AMSAIController::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
 
-    SetFocus(GetFocusedActor());
+    AActor* FocusedActor = GetFocusedActor();
+    if (FocusedActor != GetFocusActorForPriority(EAIFocusPriority::Gameplay))
+    {
+        SetFocus(FocusedActor);
+    }
 }
 
 void AMSAIController::OnPossess(APawn* InPawn)
 {
     Super::OnPossess(InPawn);
 
+    if (UMSReplaySubsystem* Replay = GetWorld()->GetSubsystem<UMSReplaySubsystem>())
+    {
+        RandomStream = Replay->MakeRandomStream();
+    }
+
     if (const auto MSCharacter = Cast<AMSAICharacter>(InPawn))
     {
         RunBehaviorTree(MSCharacter->BehaviorTree);
     }
 }
 
+void AMSAIController::ResetForRound()
+{
+    StopMovement();
+    ClearFocus(EAIFocusPriority::Gameplay);
+
+    if (UBlackboardComponent* BlackboardComponent = GetBlackboardComponent())
+    {
+        // Self actor key stays, pawn isn't changed
+        for (FBlackboard::FKey KeyID = 0; KeyID < BlackboardComponent->GetNumKeys(); ++KeyID)
+        {
+            if (BlackboardComponent->GetKeyName(KeyID) != FBlackboard::KeySelf)
+            {
+                BlackboardComponent->ClearValue(KeyID);
+            }
+        }
+    }
+
+    if (BrainComponent)
+    {
+        BrainComponent->RestartLogic();
+    }
+}
+
 AActor* AMSAIController::GetFocusedActor() const
 {
     return GetBlackboardComponent() ? Cast<AActor>(GetBlackboardComponent()->GetValueAsObject(FocusedActorKeyName)) : nullptr;
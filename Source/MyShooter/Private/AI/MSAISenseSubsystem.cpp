@@ -0,0 +1,340 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "AI/MSAISenseSubsystem.h"
+#include "AI/MSCombatantGridSubsystem.h"
+#include "Components/MSAIPerceptionComponent.h"
+#include "Components/MSHealthComponent.h"
+#include "Core/MSComponentRegistry.h"
+#include "Core/MSStats.h"
+#include "Dev/MSAllocationCounter.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "Perception/AISense_Sight.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "AIController.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAISense, All, All);
+
+static TAutoConsoleVariable<int32> CVarParallelAISense(
+    TEXT("MyShooter.ParallelAISense"),                                                                 //
+    1,                                                                                                 //
+    TEXT("1 - bots select enemies in batched parallel sense phase, 0 - one by one in their services"), //
+    ECVF_Default                                                                                       //
+);
+
+bool UMSAISenseSubsystem::IsEnabled()
+{
+    return CVarParallelAISense.GetValueOnGameThread() != 0;
+}
+
+void UMSAISenseSubsystem::RequestSense(UBehaviorTreeComponent& OwnerComp, const FMSSenseBlackboardKeys& Keys)
+{
+    Requests.Add({ &OwnerComp, OwnerComp.GetAIOwner(), Keys });
+}
+
+void UMSAISenseSubsystem::Deinitialize()
+{
+    Requests.Empty();
+    SnapshotCombatants.Empty();
+    SnapshotIndices.Empty();
+    SnapshotBots.Empty();
+    SeenIndices.Empty();
+    Results.Empty();
+
+    Super::Deinitialize();
+}
+
+void UMSAISenseSubsystem::Tick(float DeltaTime)
+{
+    MS_SCOPE_CYCLE_COUNTER(AISense);
+    MS_SCOPE_ALLOCATION_COUNTER(AISense);
+
+    BuildSnapshot(Requests);
+    ComputeResults(true);
+    WriteResults();
+
+    MS_INC_FRAME_COUNTER_BY(SensedBots, Requests.Num());
+
+    Requests.Reset();
+}
+
+bool UMSAISenseSubsystem::IsTickable() const
+{
+    return !HasAnyFlags(RF_ClassDefaultObject) && Requests.Num() > 0;
+}
+
+TStatId UMSAISenseSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMSAISenseSubsystem, STATGROUP_Tickables);
+}
+
+void UMSAISenseSubsystem::BuildSnapshot(const TArray<FSenseRequest>& InRequests)
+{
+    SnapshotCombatants.Reset();
+    SnapshotIndices.Reset();
+    SnapshotBots.Reset();
+    SeenIndices.Reset();
+
+    if (const auto CombatantGrid = GetWorld()->GetSubsystem<UMSCombatantGridSubsystem>())
+    {
+        SnapshotCombatants.Reserve(CombatantGrid->GetNumCombatants());
+        CombatantGrid->ForEachCombatant([&](APawn* Pawn, const FVector& Location, int32 TeamID) { //
+            const auto HealthComponent = FMSComponentRegistry::GetComponent<UMSHealthComponent>(Pawn);
+            const float Health = HealthComponent ? HealthComponent->GetHealth() : 0.0f;
+
+            SnapshotIndices.Add(Pawn, SnapshotCombatants.Add({ Pawn, Location, TeamID, Health }));
+        });
+    }
+
+    const FAISenseID SightID = UAISense::GetSenseID<UAISense_Sight>();
+
+    for (const FSenseRequest& Request : InRequests)
+    {
+        FSnapshotBot& Bot = SnapshotBots.AddDefaulted_GetRef();
+
+        AAIController* Controller = Request.Controller.Get();
+        const APawn* Pawn = Controller ? Controller->GetPawn() : nullptr;
+        const auto PerceptionComponent = FMSComponentRegistry::GetComponent<UMSAIPerceptionComponent>(Controller);
+        if (!PerceptionComponent)
+        {
+            continue;
+        }
+
+        Bot.bValid = true;
+        if (!Pawn)
+        {
+            continue;
+        }
+
+        const int32* PawnIndex = SnapshotIndices.Find(Pawn);
+
+        Bot.Pawn = Pawn;
+        Bot.Location = PawnIndex ? SnapshotCombatants[*PawnIndex].Location : Pawn->GetActorLocation();
+        Bot.TeamID = PawnIndex ? SnapshotCombatants[*PawnIndex].TeamID : 0;
+        Bot.SearchRadius = PerceptionComponent->GetEnemySearchRadius();
+        Bot.FirstSeenIndex = SeenIndices.Num();
+
+        // Perception data isn't safe to read from workers, so seen combatants are gathered here
+        for (auto It = PerceptionComponent->GetPerceptualDataConstIterator(); It; ++It)
+        {
+            const FActorPerceptionInfo& PerceptionInfo = It->Value;
+            const int32* SeenIndex = PerceptionInfo.IsSenseActive(SightID) ? SnapshotIndices.Find(PerceptionInfo.Target.Get()) : nullptr;
+            if (SeenIndex)
+            {
+                SeenIndices.Add(*SeenIndex);
+            }
+        }
+
+        Bot.NumSeen = SeenIndices.Num() - Bot.FirstSeenIndex;
+    }
+}
+
+void UMSAISenseSubsystem::ComputeResults(bool bParallel)
+{
+    Results.SetNum(SnapshotBots.Num(), false);
+
+    // Workers only read snapshot and write result of their own bot
+    ParallelFor(
+        SnapshotBots.Num(),                                                                    //
+        [this](int32 BotIndex) { Results[BotIndex] = ComputeResult(SnapshotBots[BotIndex]); }, //
+        bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread             //
+    );
+}
+
+void UMSAISenseSubsystem::WriteResults() const
+{
+    check(Requests.Num() == Results.Num());
+
+    for (int32 i = 0; i < Requests.Num(); ++i)
+    {
+        const FSenseRequest& Request = Requests[i];
+        const FSenseResult& Result = Results[i];
+
+        const UBehaviorTreeComponent* OwnerComp = Request.OwnerComp.Get();
+        UBlackboardComponent* Blackboard = OwnerComp ? OwnerComp->GetBlackboardComponent() : nullptr;
+        if (!Blackboard || !SnapshotBots[i].bValid)
+        {
+            continue;
+        }
+
+        APawn* Enemy = Result.EnemyIndex != INDEX_NONE ? SnapshotCombatants[Result.EnemyIndex].Pawn : nullptr;
+        Blackboard->SetValueAsObject(Request.Keys.EnemyActor, Enemy);
+
+        if (!Request.Keys.EnemyDistance.IsNone())
+        {
+            Blackboard->SetValueAsFloat(Request.Keys.EnemyDistance, Result.Distance);
+        }
+
+        if (!Request.Keys.HasLineOfFire.IsNone())
+        {
+            Blackboard->SetValueAsBool(Request.Keys.HasLineOfFire, Result.bHasLineOfFire);
+        }
+    }
+}
+
+UMSAISenseSubsystem::FSenseResult UMSAISenseSubsystem::ComputeResult(const FSnapshotBot& Bot) const
+{
+    FSenseResult Result;
+    float BestDistanceSquared = FMath::Square(Bot.SearchRadius);
+
+    for (int32 i = Bot.FirstSeenIndex; i < Bot.FirstSeenIndex + Bot.NumSeen; ++i)
+    {
+        const FSnapshotCombatant& Combatant = SnapshotCombatants[SeenIndices[i]];
+
+        // Team 0 is not assigned yet, everyone is enemy for it
+        if (Combatant.Pawn == Bot.Pawn || Combatant.Health <= 0.0f || (Bot.TeamID != 0 && Combatant.TeamID == Bot.TeamID))
+        {
+            continue;
+        }
+
+        const float DistanceSquared = FVector::DistSquared(Bot.Location, Combatant.Location);
+        if (DistanceSquared < BestDistanceSquared)
+        {
+            BestDistanceSquared = DistanceSquared;
+            Result.EnemyIndex = SeenIndices[i];
+        }
+    }
+
+    if (Result.EnemyIndex != INDEX_NONE)
+    {
+        const FVector& EnemyLocation = SnapshotCombatants[Result.EnemyIndex].Location;
+
+        Result.Distance = FMath::Sqrt(BestDistanceSquared);
+        Result.bHasLineOfFire = HasLineOfFire(Bot, EnemyLocation);
+    }
+
+    return Result;
+}
+
+bool UMSAISenseSubsystem::HasLineOfFire(const FSnapshotBot& Bot, const FVector& EnemyLocation) const
+{
+    if (Bot.TeamID == 0)
+    {
+        return true;
+    }
+
+    const FVector FireDirection = EnemyLocation - Bot.Location;
+    const float ClearanceSquared = FMath::Square(FriendlyFireClearance);
+
+    for (const FSnapshotCombatant& Combatant : SnapshotCombatants)
+    {
+        if (Combatant.TeamID != Bot.TeamID || Combatant.Pawn == Bot.Pawn)
+        {
+            continue;
+        }
+
+        // Teammates behind bot don't block its shots
+        const FVector ToCombatant = Combatant.Location - Bot.Location;
+        if ((ToCombatant | FireDirection) <= 0.0f)
+        {
+            continue;
+        }
+
+        if (FMath::PointDistToSegmentSquared(Combatant.Location, Bot.Location, EnemyLocation) < ClearanceSquared)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void UMSAISenseSubsystem::RunBenchmark(int32 Iterations)
+{
+    TArray<FSenseRequest> BenchRequests;
+    TArray<const UMSAIPerceptionComponent*> PerceptionComponents;
+
+    for (auto It = GetWorld()->GetControllerIterator(); It; ++It)
+    {
+        AAIController* Controller = Cast<AAIController>(It->Get());
+        if (const auto PerceptionComponent = FMSComponentRegistry::GetComponent<UMSAIPerceptionComponent>(Controller))
+        {
+            BenchRequests.Add({ nullptr, Controller, {} });
+            PerceptionComponents.Add(PerceptionComponent);
+        }
+    }
+
+    if (PerceptionComponents.Num() == 0)
+    {
+        UE_LOG(LogAISense, Warning, TEXT("No bots to benchmark sense phase, run with -MSBenchmark -Bots=128"));
+        return;
+    }
+
+    // Same enemy selection which is done by find enemy service when parallel sense is disabled
+    TArray<AActor*> SerialEnemies;
+    SerialEnemies.SetNum(PerceptionComponents.Num());
+
+    double StartTime = FPlatformTime::Seconds();
+    for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+    {
+        for (int32 i = 0; i < PerceptionComponents.Num(); ++i)
+        {
+            SerialEnemies[i] = PerceptionComponents[i]->GetClosestEnemy();
+        }
+    }
+    const double SerialTime = FPlatformTime::Seconds() - StartTime;
+
+    StartTime = FPlatformTime::Seconds();
+    for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+    {
+        BuildSnapshot(BenchRequests);
+        ComputeResults(false);
+    }
+    const double SingleThreadTime = FPlatformTime::Seconds() - StartTime;
+
+    StartTime = FPlatformTime::Seconds();
+    for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+    {
+        BuildSnapshot(BenchRequests);
+        ComputeResults(true);
+    }
+    const double ParallelTime = FPlatformTime::Seconds() - StartTime;
+
+    int32 NumMismatches = 0;
+    for (int32 i = 0; i < Results.Num(); ++i)
+    {
+        const APawn* Enemy = Results[i].EnemyIndex != INDEX_NONE ? SnapshotCombatants[Results[i].EnemyIndex].Pawn : nullptr;
+        NumMismatches += Enemy != SerialEnemies[i];
+    }
+
+    const double SerialMs = SerialTime * 1000.0 / Iterations;
+    const double SingleThreadMs = SingleThreadTime * 1000.0 / Iterations;
+    const double ParallelMs = ParallelTime * 1000.0 / Iterations;
+
+    const int32 NumWorkers = FTaskGraphInterface::Get().GetNumWorkerThreads();
+
+    UE_LOG(
+        LogAISense, Display, TEXT("%d bots, %d workers: serial %.3f ms, sense phase single thread %.3f ms, parallel %.3f ms"), //
+        PerceptionComponents.Num(), NumWorkers, SerialMs, SingleThreadMs, ParallelMs                                           //
+    );
+    UE_LOG(LogAISense, Display, TEXT("%d bots have different enemy in serial and parallel selection"), NumMismatches);
+
+    // Next tick snapshots requests again, benchmark results aren't written anywhere
+    Results.Reset();
+    SnapshotBots.Reset();
+}
+
+#if !UE_BUILD_SHIPPING
+
+// Compares serial enemy selection of find enemy service with sense phase on live bots
+// Usage: MyShooter.BenchAISense [Iterations]
+static void BenchAISense(const TArray<FString>& Args, UWorld* World)
+{
+    const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100;
+
+    if (const auto AISense = World ? World->GetSubsystem<UMSAISenseSubsystem>() : nullptr)
+    {
+        AISense->RunBenchmark(Iterations);
+    }
+}
+
+static FAutoConsoleCommandWithWorldAndArgs BenchAISenseCommand(
+    TEXT("MyShooter.BenchAISense"),                                           //
+    TEXT("Compare serial enemy selection of bots with parallel sense phase"), //
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BenchAISense)      //
+);
+
+#endif
@@ -0,0 +1,181 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "AI/MSAIUpdateSubsystem.h"
+#include "AI/Services/MSScheduledService.h"
+#include "Core/MSStats.h"
+#include "Dev/MSAllocationCounter.h"
+#include "Dev/MSReplaySubsystem.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "AIController.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAIUpdate, All, All);
+
+void UMSAIUpdateSubsystem::AddWorkItem(
+    UBehaviorTreeComponent& OwnerComp, const UMSScheduledService* Service, uint8* NodeMemory, float Interval)
+{
+    const double Time = GetWorld()->GetTimeSeconds();
+
+    // Spread first updates of items added on the same frame across the interval
+    const float Phase = FMath::Frac(WorkItems.Num() * 0.618034f);
+
+    FWorkItem& Item = WorkItems.AddDefaulted_GetRef();
+    Item.OwnerComp = &OwnerComp;
+    Item.Service = Service;
+    Item.NodeMemory = NodeMemory;
+    Item.Interval = FMath::Max(Interval, 0.0f);
+    Item.LastUpdateTime = Time - Item.Interval * Phase;
+}
+
+void UMSAIUpdateSubsystem::RemoveWorkItem(UBehaviorTreeComponent& OwnerComp, const UMSScheduledService* Service, uint8* NodeMemory)
+{
+    for (FWorkItem& Item : WorkItems)
+    {
+        if (Item.Service == Service && Item.NodeMemory == NodeMemory && Item.OwnerComp.Get() == &OwnerComp)
+        {
+            // Items are removed after update loop, service may cease to be relevant during it
+            Item.Service = nullptr;
+            break;
+        }
+    }
+
+    if (!bUpdating)
+    {
+        RemoveInvalidItems();
+    }
+}
+
+void UMSAIUpdateSubsystem::Deinitialize()
+{
+    WorkItems.Empty();
+    NextItemIndex = 0;
+
+    Super::Deinitialize();
+}
+
+void UMSAIUpdateSubsystem::Tick(float DeltaTime)
+{
+    MS_SCOPE_CYCLE_COUNTER(AIUpdate);
+
+    const double Time = GetWorld()->GetTimeSeconds();
+    const double StartTime = FPlatformTime::Seconds();
+    const double Budget = FrameBudgetMs / 1000.0;
+
+    // Wall clock budget lets faster build run more updates, which changes decisions and random draws of replay
+    const UMSReplaySubsystem* Replay = GetWorld()->GetSubsystem<UMSReplaySubsystem>();
+    const bool bFixedUpdateCount = Replay && (Replay->IsRecording() || Replay->IsReplaying());
+
+    bUpdating = true;
+
+    // Visit every item at most once per frame, beginning from where previous frame has stopped
+    int32 NumUpdated = 0;
+    for (int32 NumVisited = 0; NumVisited < WorkItems.Num(); ++NumVisited)
+    {
+        // At least one update per frame, so bots are never starved
+        if (NumUpdated > 0)
+        {
+            const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+            if (bFixedUpdateCount ? NumUpdated >= ReplayUpdatesPerFrame : ElapsedTime >= Budget)
+            {
+                break;
+            }
+        }
+
+        NextItemIndex %= WorkItems.Num();
+        FWorkItem& Item = WorkItems[NextItemIndex++];
+
+        UBehaviorTreeComponent* OwnerComp = Item.OwnerComp.Get();
+        const float TimeSinceUpdate = static_cast<float>(Time - Item.LastUpdateTime);
+        if (!Item.Service || !OwnerComp || TimeSinceUpdate < Item.Interval)
+        {
+            continue;
+        }
+
+        const float Staleness = TimeSinceUpdate - Item.Interval;
+        Item.MaxStaleness = FMath::Max(Item.MaxStaleness, Staleness);
+        Item.StalenessSum += Staleness;
+        ++Item.NumUpdates;
+
+        Item.LastUpdateTime = Time;
+        {
+            MS_SCOPE_ALLOCATION_COUNTER(AIUpdate);
+            Item.Service->ScheduledTick(*OwnerComp, Item.NodeMemory, TimeSinceUpdate);
+        }
+
+        ++NumUpdated;
+    }
+
+    bUpdating = false;
+
+    MS_INC_FRAME_COUNTER_BY(AIUpdates, NumUpdated);
+
+    RemoveInvalidItems();
+}
+
+bool UMSAIUpdateSubsystem::IsTickable() const
+{
+    return !HasAnyFlags(RF_ClassDefaultObject) && WorkItems.Num() > 0;
+}
+
+TStatId UMSAIUpdateSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMSAIUpdateSubsystem, STATGROUP_Tickables);
+}
+
+void UMSAIUpdateSubsystem::RemoveInvalidItems()
+{
+    for (int32 i = WorkItems.Num() - 1; i >= 0; --i)
+    {
+        if (!WorkItems[i].Service || !WorkItems[i].OwnerComp.IsValid())
+        {
+            // Keep round robin order of the rest items
+            WorkItems.RemoveAt(i, 1, false);
+            if (i < NextItemIndex)
+            {
+                --NextItemIndex;
+            }
+        }
+    }
+}
+
+void UMSAIUpdateSubsystem::LogStats() const
+{
+    UE_LOG(LogAIUpdate, Display, TEXT("AI update: %d work items, budget %.2f ms"), WorkItems.Num(), FrameBudgetMs);
+
+    for (const FWorkItem& Item : WorkItems)
+    {
+        const UBehaviorTreeComponent* OwnerComp = Item.OwnerComp.Get();
+        const AAIController* Controller = OwnerComp ? OwnerComp->GetAIOwner() : nullptr;
+        if (!Item.Service || !Controller)
+        {
+            continue;
+        }
+
+        const float AvgStaleness = Item.NumUpdates > 0 ? Item.StalenessSum / Item.NumUpdates : 0.0f;
+
+        UE_LOG(
+            LogAIUpdate, Display, TEXT("%s %s: interval %.2f s, updates %d, avg staleness %.1f ms, max staleness %.1f ms"), //
+            *Controller->GetName(), *Item.Service->GetNodeName(), Item.Interval, Item.NumUpdates,                           //
+            AvgStaleness * 1000.0f, Item.MaxStaleness * 1000.0f                                                             //
+        );
+    }
+}
+
+#if !UE_BUILD_SHIPPING
+
+static void LogAIUpdateStats(UWorld* World)
+{
+    if (const auto AIUpdate = World ? World->GetSubsystem<UMSAIUpdateSubsystem>() : nullptr)
+    {
+        AIUpdate->LogStats();
+    }
+}
+
+static FAutoConsoleCommandWithWorld LogAIUpdateStatsCommand(
+    TEXT("MyShooter.AIUpdateStats"),                                  //
+    TEXT("Log per bot staleness of scheduled AI service updates"),    //
+    FConsoleCommandWithWorldDelegate::CreateStatic(&LogAIUpdateStats) //
+);
+
+#endif
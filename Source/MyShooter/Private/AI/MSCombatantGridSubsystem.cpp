@@ -0,0 +1,110 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "AI/MSCombatantGridSubsystem.h"
+#include "Player/MSPlayerState.h"
+#include "GameFramework/Pawn.h"
+
+void UMSCombatantGridSubsystem::AddCombatant(APawn* Pawn)
+{
+    if (!Pawn || CombatantIndices.Contains(Pawn))
+    {
+        return;
+    }
+
+    const int32 TeamID = GetTeamID(Pawn);
+    const FVector Location = Pawn->GetActorLocation();
+
+    const int32 Index = Combatants.Add({ Pawn, Location, GetCellKey(Location, TeamID) });
+    CombatantIndices.Add(Pawn, Index);
+    AddToCell(Index);
+}
+
+void UMSCombatantGridSubsystem::RemoveCombatant(APawn* Pawn)
+{
+    int32 Index;
+    if (!CombatantIndices.RemoveAndCopyValue(Pawn, Index))
+    {
+        return;
+    }
+
+    RemoveFromCell(Index);
+
+    // Move last combatant to removed slot
+    const int32 LastIndex = Combatants.Num() - 1;
+    if (Index != LastIndex)
+    {
+        RemoveFromCell(LastIndex);
+        Combatants[Index] = Combatants[LastIndex];
+        CombatantIndices[Combatants[Index].Pawn] = Index;
+        AddToCell(Index);
+    }
+    Combatants.Pop(false);
+}
+
+void UMSCombatantGridSubsystem::Deinitialize()
+{
+    Combatants.Empty();
+    CombatantIndices.Empty();
+    Cells.Empty();
+    Teams.Empty();
+
+    Super::Deinitialize();
+}
+
+void UMSCombatantGridSubsystem::Tick(float DeltaTime)
+{
+    for (int32 Index = 0; Index < Combatants.Num(); ++Index)
+    {
+        FCombatant& Combatant = Combatants[Index];
+
+        // Team may be assigned after pawn has begun play
+        const int32 TeamID = GetTeamID(Combatant.Pawn);
+        Combatant.Location = Combatant.Pawn->GetActorLocation();
+
+        const FIntVector CellKey = GetCellKey(Combatant.Location, TeamID);
+        if (CellKey != Combatant.CellKey)
+        {
+            RemoveFromCell(Index);
+            Combatant.CellKey = CellKey;
+            AddToCell(Index);
+        }
+    }
+}
+
+bool UMSCombatantGridSubsystem::IsTickable() const
+{
+    return !HasAnyFlags(RF_ClassDefaultObject) && Combatants.Num() > 0;
+}
+
+TStatId UMSCombatantGridSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMSCombatantGridSubsystem, STATGROUP_Tickables);
+}
+
+int32 UMSCombatantGridSubsystem::GetTeamID(const APawn* Pawn)
+{
+    const AMSPlayerState* PlayerState = Pawn ? Pawn->GetPlayerState<AMSPlayerState>() : nullptr;
+    return PlayerState ? PlayerState->GetTeamID() : 0;
+}
+
+FIntVector UMSCombatantGridSubsystem::GetCellKey(const FVector& Location, int32 TeamID)
+{
+    return FIntVector(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize), TeamID);
+}
+
+void UMSCombatantGridSubsystem::AddToCell(int32 Index)
+{
+    const FIntVector& CellKey = Combatants[Index].CellKey;
+    Cells.FindOrAdd(CellKey).Add(Index);
+    Teams.AddUnique(CellKey.Z);
+}
+
+void UMSCombatantGridSubsystem::RemoveFromCell(int32 Index)
+{
+    const FIntVector& CellKey = Combatants[Index].CellKey;
+    if (FCell* Cell = Cells.Find(CellKey))
+    {
+        // Empty cells are kept to not reallocate them when combatants move back
+        Cell->RemoveSingleSwap(Index, false);
+    }
+}
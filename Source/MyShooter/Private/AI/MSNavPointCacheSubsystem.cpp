@@ -0,0 +1,167 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "AI/MSNavPointCacheSubsystem.h"
+#include "Core/MSStats.h"
+#include "NavigationSystem.h"
+#include "Engine/World.h"
+
+void UMSNavPointCacheSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    RegionSize = FMath::Max(RegionSize, 100.0f);
+    PointsPerRegion = FMath::Max(PointsPerRegion, 1);
+    PointsPerRefresh = FMath::Clamp(PointsPerRefresh, 1, PointsPerRegion);
+    DrawsPerReplacedPoint = FMath::Max(DrawsPerReplacedPoint, 1);
+    MaxSamplesPerFrame = FMath::Max(MaxSamplesPerFrame, 1);
+}
+
+void UMSNavPointCacheSubsystem::Deinitialize()
+{
+    if (UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+    {
+        NavSystem->OnNavigationGenerationFinishedDelegate.RemoveAll(this);
+    }
+
+    Regions.Empty();
+    RefillQueue.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UMSNavPointCacheSubsystem::DrawPoint(const FVector& Origin, float Radius, const FRandomStream& RandomStream, FVector& OutPoint)
+{
+    const FIntVector RegionKey = GetRegionKey(Origin);
+
+    FRegion& Region = Regions.FindOrAdd(RegionKey);
+    if (Region.Points.Num() == 0)
+    {
+        Region.Anchor = Origin;
+    }
+
+    if (Region.Points.Num() < PointsPerRegion)
+    {
+        QueueRefill(RegionKey, Region);
+    }
+    else if (++Region.NumDrawsSinceRefill >= PointsPerRefresh * DrawsPerReplacedPoint)
+    {
+        QueueRefill(RegionKey, Region);
+    }
+
+    const float RadiusSquared = FMath::Square(Radius);
+    for (int32 Attempt = 0; Attempt < MaxDrawAttempts && Region.Points.Num() > 0; ++Attempt)
+    {
+        const FVector& Point = Region.Points[RandomStream.RandHelper(Region.Points.Num())];
+        if (FVector::DistSquared(Point, Origin) <= RadiusSquared)
+        {
+            MS_INC_FRAME_COUNTER(NavPointCacheHits);
+            OutPoint = Point;
+            return true;
+        }
+    }
+
+    MS_INC_FRAME_COUNTER(NavPointCacheMisses);
+    return false;
+}
+
+void UMSNavPointCacheSubsystem::Tick(float DeltaTime)
+{
+    UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+    if (!NavSystem)
+    {
+        return;
+    }
+
+    // Navigation system is created after subsystems, so bind on first tick
+    NavSystem->OnNavigationGenerationFinishedDelegate.AddUniqueDynamic(this, &UMSNavPointCacheSubsystem::OnNavigationGenerationFinished);
+
+    int32 NumSamples = 0;
+    int32 QueueIndex = 0;
+
+    for (; QueueIndex < RefillQueue.Num() && NumSamples < MaxSamplesPerFrame; ++QueueIndex)
+    {
+        FRegion* Region = Regions.Find(RefillQueue[QueueIndex]);
+        if (!Region)
+        {
+            continue;
+        }
+
+        // Fill region up to its capacity, then replace only a few of the oldest points to keep variety
+        if (Region->NumPendingSamples == 0)
+        {
+            const int32 NumMissing = PointsPerRegion - Region->Points.Num();
+            Region->NumPendingSamples = NumMissing > 0 ? NumMissing : PointsPerRefresh;
+        }
+
+        bool bSampleFailed = false;
+        for (; Region->NumPendingSamples > 0 && NumSamples < MaxSamplesPerFrame; --Region->NumPendingSamples)
+        {
+            ++NumSamples;
+
+            FNavLocation NavLocation;
+            if (!NavSystem->GetRandomReachablePointInRadius(Region->Anchor, RegionSize, NavLocation))
+            {
+                bSampleFailed = true;
+                break;
+            }
+
+            if (Region->Points.Num() < PointsPerRegion)
+            {
+                Region->Points.Add(NavLocation.Location);
+            }
+            else
+            {
+                Region->Points[Region->NextReplaceIndex] = NavLocation.Location;
+                Region->NextReplaceIndex = (Region->NextReplaceIndex + 1) % PointsPerRegion;
+            }
+        }
+
+        // Out of budget, region keeps its place and continues on next frame
+        if (!bSampleFailed && Region->NumPendingSamples > 0)
+        {
+            break;
+        }
+
+        // On failed sample region is retried by next draw, empty region takes new anchor from it
+        Region->NumPendingSamples = 0;
+        Region->NumDrawsSinceRefill = 0;
+        Region->bQueued = false;
+    }
+
+    RefillQueue.RemoveAt(0, QueueIndex, false);
+}
+
+bool UMSNavPointCacheSubsystem::IsTickable() const
+{
+    return !HasAnyFlags(RF_ClassDefaultObject) && RefillQueue.Num() > 0;
+}
+
+TStatId UMSNavPointCacheSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMSNavPointCacheSubsystem, STATGROUP_Tickables);
+}
+
+FIntVector UMSNavPointCacheSubsystem::GetRegionKey(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt(Location.X / RegionSize), //
+        FMath::FloorToInt(Location.Y / RegionSize), //
+        FMath::FloorToInt(Location.Z / RegionSize)  //
+    );
+}
+
+void UMSNavPointCacheSubsystem::QueueRefill(const FIntVector& RegionKey, FRegion& Region)
+{
+    if (!Region.bQueued)
+    {
+        Region.bQueued = true;
+        RefillQueue.Add(RegionKey);
+    }
+}
+
+void UMSNavPointCacheSubsystem::OnNavigationGenerationFinished(ANavigationData* NavData)
+{
+    // Cached points may be unreachable now, regions are refilled on next draws
+    Regions.Empty();
+    RefillQueue.Empty();
+}
@@ -1,33 +1,43 @@
 // MyShooter Game, All Rights Reserved.
 
 #include "AI/Services/MSChangeWeaponService.h"
-#include "AIController.h"
+#include "AI/MSAIController.h"
 #include "Components/MSAIWeaponComponent.h"
-#include "Core/CoreUtils.h"
+#include "Core/MSComponentRegistry.h"
+#include "Core/MSStats.h"
 
 UMSChangeWeaponService::UMSChangeWeaponService()
 {
     NodeName = "Change Weapon";
 }
 
-void UMSChangeWeaponService::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+void UMSChangeWeaponService::OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
-    if (!bCanTick || Probability <= 0.0f || FMath::FRand() > Probability)
+    CastInstanceNodeMemory<FChangeWeaponMemory>(NodeMemory)->CooldownLeft = 0.0f;
+
+    Super::OnBecomeRelevant(OwnerComp, NodeMemory);
+}
+
+void UMSChangeWeaponService::ScheduledTick(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) const
+{
+    MS_SCOPE_CYCLE_COUNTER(ChangeWeaponService);
+
+    FChangeWeaponMemory* Memory = CastInstanceNodeMemory<FChangeWeaponMemory>(NodeMemory);
+    Memory->CooldownLeft -= DeltaSeconds;
+
+    const AMSAIController* Controller = Cast<AMSAIController>(OwnerComp.GetAIOwner());
+    if (!Controller || Memory->CooldownLeft > 0.0f || Probability <= 0.0f || Controller->GetRandomStream().FRand() > Probability)
     {
         return;
     }
 
-    if (const AAIController* Controller = OwnerComp.GetAIOwner())
+    if (APawn* Pawn = Controller->GetPawn())
     {
-        if (APawn* Pawn = Controller->GetPawn())
+        if (auto WeaponComponent = FMSComponentRegistry::GetComponent<UMSAIWeaponComponent>(Pawn))
         {
-            if (auto WeaponComponent = FCoreUtils::GetActorComponent<UMSAIWeaponComponent>(Pawn))
-            {
-                WeaponComponent->NextWeapon();
+            WeaponComponent->NextWeapon();
 
-                bCanTick = false;
-                GetWorld()->GetTimerManager().SetTimer(Timer, this, &UMSChangeWeaponService::OnCanTickAgain, TimeRateBetweenTicks, false);
-            }
+            Memory->CooldownLeft = TimeRateBetweenTicks;
         }
     }
 }
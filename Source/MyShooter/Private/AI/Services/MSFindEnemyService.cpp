@@ -1,9 +1,11 @@
 // MyShooter Game, All Rights Reserved.
 
 #include "AI/Services/MSFindEnemyService.h"
+#include "AI/MSAISenseSubsystem.h"
 #include "Components/MSAIPerceptionComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
-#include "Core/CoreUtils.h"
+#include "Core/MSComponentRegistry.h"
+#include "Core/MSStats.h"
 #include "AIController.h"
 
 UMSFindEnemyService::UMSFindEnemyService()
@@ -11,16 +13,29 @@ UMSFindEnemyService::UMSFindEnemyService()
     NodeName = "Find Enemy";
 }
 
-void UMSFindEnemyService::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+void UMSFindEnemyService::ScheduledTick(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) const
 {
+    MS_SCOPE_CYCLE_COUNTER(FindEnemyService);
+
+    // Enemy is selected later in the frame together with other bots
+    UMSAISenseSubsystem* AISense = OwnerComp.GetWorld()->GetSubsystem<UMSAISenseSubsystem>();
+    if (AISense && UMSAISenseSubsystem::IsEnabled())
+    {
+        FMSSenseBlackboardKeys Keys;
+        Keys.EnemyActor = EnemyActorKey.SelectedKeyName;
+        Keys.EnemyDistance = EnemyDistanceKey.SelectedKeyName;
+        Keys.HasLineOfFire = HasLineOfFireKey.SelectedKeyName;
+
+        AISense->RequestSense(OwnerComp, Keys);
+        return;
+    }
+
     if (const auto BlackboardComponent = OwnerComp.GetBlackboardComponent())
     {
         const auto Controller = OwnerComp.GetAIOwner();
-        if (const auto PerceptionComponent = FCoreUtils::GetActorComponent<UMSAIPerceptionComponent>(Controller))
+        if (const auto PerceptionComponent = FMSComponentRegistry::GetComponent<UMSAIPerceptionComponent>(Controller))
         {
             BlackboardComponent->SetValueAsObject(EnemyActorKey.SelectedKeyName, PerceptionComponent->GetClosestEnemy());
         }
     }
-
-    Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
 }
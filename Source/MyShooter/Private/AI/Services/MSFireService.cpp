@@ -5,21 +5,24 @@
 #include "BehaviorTree/BlackboardComponent.h"
 #include "Components/MSWeaponComponent.h"
 #include "Components/MSHealthComponent.h"
-#include "Core/CoreUtils.h"
+#include "Core/MSComponentRegistry.h"
+#include "Core/MSStats.h"
 
 UMSFireService::UMSFireService()
 {
     NodeName = "Fire";
 }
 
-void UMSFireService::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+void UMSFireService::ScheduledTick(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) const
 {
+    MS_SCOPE_CYCLE_COUNTER(FireService);
+
     bool bHasAim = false;
     if (const UBlackboardComponent* Blackboard = OwnerComp.GetBlackboardComponent())
     {
         if (AActor* Enemy = Cast<AActor>(Blackboard->GetValueAsObject(EnemyActorKey.SelectedKeyName)))
         {
-            auto HealthComponent = FCoreUtils::GetActorComponent<UMSHealthComponent>(Enemy);
+            auto HealthComponent = FMSComponentRegistry::GetComponent<UMSHealthComponent>(Enemy);
             if (HealthComponent && !HealthComponent->IsDead())
             {
                 bHasAim = true;
@@ -29,14 +32,12 @@ void UMSFireService::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemo
 
     if (const AAIController* Controller = OwnerComp.GetAIOwner())
     {
-        auto WeaponComponent = FCoreUtils::GetActorComponent<UMSWeaponComponent>(Controller->GetPawn());
-        auto HealthComponent = FCoreUtils::GetActorComponent<UMSHealthComponent>(Controller->GetPawn());
+        auto WeaponComponent = FMSComponentRegistry::GetComponent<UMSWeaponComponent>(Controller->GetPawn());
+        auto HealthComponent = FMSComponentRegistry::GetComponent<UMSHealthComponent>(Controller->GetPawn());
 
         if (WeaponComponent && HealthComponent)
         {
             bHasAim && !HealthComponent->IsDead() ? WeaponComponent->StartFire() : WeaponComponent->StopFire();
         }
     }
-
-    Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
 }
@@ -0,0 +1,32 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "AI/Services/MSScheduledService.h"
+#include "AI/MSAIUpdateSubsystem.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+
+UMSScheduledService::UMSScheduledService()
+{
+    bNotifyTick = false;
+    bNotifyBecomeRelevant = true;
+    bNotifyCeaseRelevant = true;
+}
+
+void UMSScheduledService::OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+    Super::OnBecomeRelevant(OwnerComp, NodeMemory);
+
+    if (UMSAIUpdateSubsystem* AIUpdate = OwnerComp.GetWorld()->GetSubsystem<UMSAIUpdateSubsystem>())
+    {
+        AIUpdate->AddWorkItem(OwnerComp, this, NodeMemory, Interval);
+    }
+}
+
+void UMSScheduledService::OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+    if (UMSAIUpdateSubsystem* AIUpdate = OwnerComp.GetWorld()->GetSubsystem<UMSAIUpdateSubsystem>())
+    {
+        AIUpdate->RemoveWorkItem(OwnerComp, this, NodeMemory);
+    }
+
+    Super::OnCeaseRelevant(OwnerComp, NodeMemory);
+}
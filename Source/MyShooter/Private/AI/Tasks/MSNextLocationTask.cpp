@@ -2,6 +2,7 @@
 
 #include "AI/Tasks/MSNextLocationTask.h"
 #include "AI/MSAIController.h"
+#include "AI/MSNavPointCacheSubsystem.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "NavigationSystem.h"
 
@@ -48,10 +49,18 @@ EBTNodeResult::Type UMSNextLocationTask::ExecuteTask(UBehaviorTreeComponent& Own
         FromLocation = FromActor->GetActorLocation();
     }
 
-    const bool bFound = NavSystem->GetRandomReachablePointInRadius(FromLocation, Radius, NavLocation);
-    if (!bFound)
+    // Draw pre-sampled point if possible, otherwise query navmesh directly while cache is filling
+    UMSNavPointCacheSubsystem* NavPointCache = Pawn->GetWorld()->GetSubsystem<UMSNavPointCacheSubsystem>();
+    const AMSAIController* MSController = Cast<AMSAIController>(Controller);
+    const bool bDrawn = NavPointCache && MSController && //
+                        NavPointCache->DrawPoint(FromLocation, Radius, MSController->GetRandomStream(), NavLocation.Location);
+    if (!bDrawn)
     {
-        return EBTNodeResult::Failed;
+        const bool bFound = NavSystem->GetRandomReachablePointInRadius(FromLocation, Radius, NavLocation);
+        if (!bFound)
+        {
+            return EBTNodeResult::Failed;
+        }
     }
 
     Blackboard->SetValueAsVector(AimLocationKey.SelectedKeyName, NavLocation.Location);
@@ -1,9 +1,10 @@
 // MyShooter Game, All Rights Reserved.
 
 #include "Animations/MSAnimNotify.h"
+#include "Animations/MSAnimNotifyRouter.h"
 
 void UMSAnimNotify::Notify(USkeletalMeshComponent* MeshComponent, UAnimSequenceBase* Animation)
 {
-    OnNotified.Broadcast(MeshComponent);
+    FMSAnimNotifyRouter::Get().Dispatch(this, MeshComponent);
     Super::Notify(MeshComponent, Animation);
 }
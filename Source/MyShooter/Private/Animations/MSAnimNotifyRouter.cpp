@@ -0,0 +1,127 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "Animations/MSAnimNotifyRouter.h"
+#include "Animations/MSAnimNotify.h"
+#include "Core/MSStats.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAnimNotifyRouter, All, All);
+
+FMSAnimNotifyRouter& FMSAnimNotifyRouter::Get()
+{
+    static FMSAnimNotifyRouter Router;
+    return Router;
+}
+
+void FMSAnimNotifyRouter::Register(const USkeletalMeshComponent* Mesh, const UClass* NotifyClass, const FMSAnimNotifyDelegate& Delegate)
+{
+    check(IsInGameThread());
+
+    if (!Mesh || !NotifyClass)
+    {
+        return;
+    }
+
+    FMeshListeners& Listeners = MeshListeners.FindOrAdd(Mesh);
+    for (FListener& Listener : Listeners)
+    {
+        if (Listener.NotifyClass == NotifyClass)
+        {
+            UE_LOG(LogAnimNotifyRouter, Warning, TEXT("%s listener of %s is replaced"), *NotifyClass->GetName(), *Mesh->GetPathName());
+            Listener.Delegate = Delegate;
+            return;
+        }
+    }
+
+    Listeners.Add({ NotifyClass, Delegate });
+}
+
+void FMSAnimNotifyRouter::Unregister(const USkeletalMeshComponent* Mesh, const UClass* NotifyClass)
+{
+    check(IsInGameThread());
+
+    FMeshListeners* Listeners = MeshListeners.Find(Mesh);
+    if (!Listeners)
+    {
+        return;
+    }
+
+    Listeners->RemoveAllSwap([NotifyClass](const FListener& Listener) { return Listener.NotifyClass == NotifyClass; });
+
+    if (Listeners->Num() == 0)
+    {
+        MeshListeners.Remove(Mesh);
+    }
+}
+
+void FMSAnimNotifyRouter::Dispatch(const UMSAnimNotify* Notify, USkeletalMeshComponent* Mesh)
+{
+    ++NumNotifies;
+
+    // Animation previews in editor have no listeners
+    const FMeshListeners* Listeners = Mesh ? MeshListeners.Find(Mesh) : nullptr;
+    if (Listeners)
+    {
+        // Blueprint subclasses of notifies reach listeners of their native class
+        const UClass* NotifyClass = Notify->GetClass();
+        for (const FListener& Listener : *Listeners)
+        {
+            if (NotifyClass->IsChildOf(Listener.NotifyClass))
+            {
+                ++NumCallbacks;
+                MS_INC_FRAME_COUNTER(AnimNotifyCallbacks);
+
+                Listener.Delegate.ExecuteIfBound(Mesh);
+                return;
+            }
+        }
+    }
+
+    ++NumUnrouted;
+}
+
+void FMSAnimNotifyRouter::LogStats() const
+{
+    int32 NumListeners = 0;
+    for (const auto& Pair : MeshListeners)
+    {
+        NumListeners += Pair.Value.Num();
+    }
+
+    const double CallbacksPerNotify = NumNotifies > 0 ? static_cast<double>(NumCallbacks) / NumNotifies : 0.0;
+
+    UE_LOG(
+        LogAnimNotifyRouter, Display, TEXT("%d meshes, %d listeners: %lld notifies, %lld callbacks (%.2f per notify), %lld unrouted"), //
+        MeshListeners.Num(), NumListeners, NumNotifies, NumCallbacks, CallbacksPerNotify, NumUnrouted                                  //
+    );
+}
+
+void FMSAnimNotifyRouter::ResetStats()
+{
+    NumNotifies = 0;
+    NumCallbacks = 0;
+    NumUnrouted = 0;
+}
+
+#if !UE_BUILD_SHIPPING
+
+// Every notify should reach at most one listener, e.g. one callback per reload regardless of number of characters
+// Usage: MyShooter.AnimNotifyStats [Reset]
+static void LogAnimNotifyStats(const TArray<FString>& Args)
+{
+    FMSAnimNotifyRouter::Get().LogStats();
+
+    if (Args.Num() > 0 && Args[0] == TEXT("Reset"))
+    {
+        FMSAnimNotifyRouter::Get().ResetStats();
+    }
+}
+
+static FAutoConsoleCommand LogAnimNotifyStatsCommand(
+    TEXT("MyShooter.AnimNotifyStats"),                                     //
+    TEXT("Log anim notify listeners and callbacks per dispatched notify"), //
+    FConsoleCommandWithArgsDelegate::CreateStatic(&LogAnimNotifyStats)     //
+);
+
+#endif
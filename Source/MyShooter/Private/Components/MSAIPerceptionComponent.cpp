@@ -1,21 +1,37 @@
 // MyShooter Game, All Rights Reserved.
 
 #include "Components/MSAIPerceptionComponent.h"
-#include "Components/MSHealthComponent.h"
-#include "Core/CoreUtils.h"
+#include "Core/MSComponentRegistry.h"
+#include "Core/MSStats.h"
+#include "AI/MSCombatantGridSubsystem.h"
+#include "Player/MSPlayerState.h"
 #include "Perception/AISense_Sight.h"
+#include "Perception/AISenseConfig_Sight.h"
 #include "AIController.h"
 
-AActor* UMSAIPerceptionComponent::GetClosestEnemy() const
+void UMSAIPerceptionComponent::BeginPlay()
 {
-    TArray<AActor*> PercieveActors;
+    Super::BeginPlay();
 
-    GetCurrentlyPerceivedActors(UAISense_Sight::StaticClass(), PercieveActors);
-    if (PercieveActors.Num() <= 0)
+    if (const auto SightConfig = Cast<UAISenseConfig_Sight>(GetSenseConfig(UAISense::GetSenseID<UAISense_Sight>())))
     {
-        return nullptr;
+        EnemySearchRadius = SightConfig->LoseSightRadius;
     }
 
+    FMSComponentRegistry::Get().Register(this);
+}
+
+void UMSAIPerceptionComponent::EndPlay(EEndPlayReason::Type Reason)
+{
+    FMSComponentRegistry::Get().Unregister(this);
+
+    Super::EndPlay(Reason);
+}
+
+AActor* UMSAIPerceptionComponent::GetClosestEnemy() const
+{
+    MS_SCOPE_CYCLE_COUNTER(GetClosestEnemy);
+
     const auto Controller = Cast<AAIController>(GetOwner());
     if (!Controller)
     {
@@ -28,24 +44,20 @@ AActor* UMSAIPerceptionComponent::GetClosestEnemy() const
         return nullptr;
     }
 
-    float BestDistance = MAX_FLT;
-    AActor* BestActor = nullptr;
-
-    for (const auto Actor : PercieveActors)
+    const UWorld* World = GetWorld();
+    const auto CombatantGrid = World ? World->GetSubsystem<UMSCombatantGridSubsystem>() : nullptr;
+    if (!CombatantGrid)
     {
-        // TODO: Check if actor is our teammate
-
-        const auto HealthComponent = FCoreUtils::GetActorComponent<UMSHealthComponent>(Actor);
-        if (HealthComponent && !HealthComponent->IsDead())
-        {
-            const float Distance = (Actor->GetActorLocation() - Pawn->GetActorLocation()).Size();
-            if (Distance < BestDistance)
-            {
-                BestDistance = Distance;
-                BestActor = Actor;
-            }
-        }
+        return nullptr;
     }
 
-    return BestActor;
+    const auto PlayerState = Controller->GetPlayerState<AMSPlayerState>();
+    const int32 TeamID = PlayerState ? PlayerState->GetTeamID() : 0;
+    const FAISenseID SightID = UAISense::GetSenseID<UAISense_Sight>();
+
+    // Grid holds only living combatants, enemy should be also seen by bot
+    return CombatantGrid->FindClosestEnemy(Pawn->GetActorLocation(), TeamID, EnemySearchRadius, [&](const APawn* Enemy) {
+        const FActorPerceptionInfo* PerceptionInfo = Enemy != Pawn ? GetActorInfo(*Enemy) : nullptr;
+        return PerceptionInfo && PerceptionInfo->IsSenseActive(SightID);
+    });
 }
@@ -2,7 +2,11 @@
 
 #include "Components/MSHealthComponent.h"
 #include "GameFramework/Actor.h"
-#include "TimerManager.h"
+#include "Engine/World.h"
+#include "Core/MSComponentRegistry.h"
+#include "Core/MSDamageQueueSubsystem.h"
+#include "Core/MSRegenerationSubsystem.h"
+#include "Core/MSStats.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogHealthComponent, All, All);
 
@@ -23,12 +27,48 @@ bool UMSHealthComponent::TryToAddHealth(float InHealth)
     return true;
 }
 
+void UMSHealthComponent::ResetHealth()
+{
+    StopRegeneration();
+    PendingDamage.Reset();
+
+    SetHealth(MaxHealth);
+}
+
+const FMSDamageRecord* UMSHealthComponent::GetKillingDamage() const
+{
+    return DamageLog.IsValidIndex(KillingDamageIndex) ? &DamageLog[KillingDamageIndex] : nullptr;
+}
+
+void UMSHealthComponent::ResolvePendingDamage()
+{
+    if (PendingDamage.Num() == 0)
+    {
+        return;
+    }
+
+    // Damage log keeps records of the killing frame, so killing damage stays valid after death
+    if (IsDead())
+    {
+        PendingDamage.Reset();
+        return;
+    }
+
+    // Pending damage is cleared before broadcasts, so damage dealt by them is queued again
+    Swap(DamageLog, PendingDamage);
+    PendingDamage.Reset();
+
+    ApplyDamageLog();
+}
+
 void UMSHealthComponent::BeginPlay()
 {
     Super::BeginPlay();
 
     checkf(MaxHealth > 0, TEXT("MaxHealth should be > 0"));
 
+    FMSComponentRegistry::Get().Register(this);
+
     if (AActor* ComponentOwner = GetOwner())
     {
         ComponentOwner->OnTakeAnyDamage.AddDynamic(this, &UMSHealthComponent::OnTakeAnyDamage);
@@ -37,19 +77,62 @@ void UMSHealthComponent::BeginPlay()
     SetHealth(MaxHealth);
 }
 
+void UMSHealthComponent::EndPlay(EEndPlayReason::Type Reason)
+{
+    FMSComponentRegistry::Get().Unregister(this);
+    StopRegeneration();
+
+    Super::EndPlay(Reason);
+}
+
 void UMSHealthComponent::OnTakeAnyDamage(AActor* DamagedActor, float Damage, const UDamageType* DamageType, AController* InstigatedBy, AActor* DamageCauser)
 {
+    MS_SCOPE_CYCLE_COUNTER(OnTakeAnyDamage);
+
     if (Damage <= 0.0f || IsDead())
     {
         return;
     }
 
-    if (bAutoHeal)
+    UWorld* World = GetWorld();
+    const FMSDamageRecord DamageRecord = { Damage, World->GetTimeSeconds(), DamageType, InstigatedBy, DamageCauser };
+
+    if (UMSDamageQueueSubsystem* DamageQueue = bCoalesceDamage ? World->GetSubsystem<UMSDamageQueueSubsystem>() : nullptr)
     {
-        GetWorld()->GetTimerManager().SetTimer(AutoHealTimer, this, &UMSHealthComponent::OnAutoHealUpdateTimerFired, AutoHealUpdateTime, true, AutoHealDelayTime);
+        if (PendingDamage.Num() == 0)
+        {
+            DamageQueue->AddTarget(this);
+        }
+        PendingDamage.Add(DamageRecord);
+        return;
     }
 
-    SetHealth(Health - Damage);
+    DamageLog.Reset();
+    DamageLog.Add(DamageRecord);
+    ApplyDamageLog();
+}
+
+void UMSHealthComponent::ApplyDamageLog()
+{
+    float TotalDamage = 0.0f;
+    KillingDamageIndex = INDEX_NONE;
+
+    for (int32 i = 0; i < DamageLog.Num(); ++i)
+    {
+        TotalDamage += DamageLog[i].Damage;
+        if (KillingDamageIndex == INDEX_NONE && FMath::IsNearlyZero(FMath::Max(Health - TotalDamage, 0.0f)))
+        {
+            KillingDamageIndex = i;
+        }
+    }
+
+    UMSRegenerationSubsystem* Regeneration = GetWorld()->GetSubsystem<UMSRegenerationSubsystem>();
+    if (bAutoHeal && Regeneration && AutoHealUpdateTime > 0.0f)
+    {
+        Regeneration->StartRegeneration(this, AutoHealDelayTime, AutoHealModifier / AutoHealUpdateTime, MaxHealth);
+    }
+
+    SetHealth(Health - TotalDamage);
 
     PlayCameraShake();
 }
@@ -63,24 +146,21 @@ void UMSHealthComponent::SetHealth(float InHealth)
     if (IsDead())
     {
         OnDeath.Broadcast();
-
-        if (bAutoHeal)
-        {
-            GetWorld()->GetTimerManager().ClearTimer(AutoHealTimer);
-        }
+        StopRegeneration();
     }
     else if (IsHealthFull())
     {
-        if (bAutoHeal)
-        {
-            GetWorld()->GetTimerManager().ClearTimer(AutoHealTimer);
-        }
+        StopRegeneration();
     }
 }
 
-void UMSHealthComponent::OnAutoHealUpdateTimerFired()
+void UMSHealthComponent::StopRegeneration()
 {
-    SetHealth(Health + AutoHealModifier);
+    UWorld* World = GetWorld();
+    if (UMSRegenerationSubsystem* Regeneration = bAutoHeal && World ? World->GetSubsystem<UMSRegenerationSubsystem>() : nullptr)
+    {
+        Regeneration->StopRegeneration(this);
+    }
 }
 
 void UMSHealthComponent::PlayCameraShake()
@@ -1,13 +1,15 @@
 // MyShooter Game, All Rights Reserved.
 
 #include "Components/MSWeaponComponent.h"
-#include "Components/MSWeaponFlashlightComponent.h"
 #include "Weapon/MSWeapon.h"
 #include "GameFramework/Character.h"
+#include "Animation/AnimInstance.h"
 #include "Animations/MSEquipFinishedAnimNotify.h"
 #include "Animations/MSReloadFinishedAnimNotify.h"
 #include "Animations/AnimUtils.h"
-#include "Core/CoreUtils.h"
+#include "Animations/MSAnimNotifyRouter.h"
+#include "Core/MSComponentRegistry.h"
+#include "Core/MSActorPoolSubsystem.h"
 
 static constexpr int32 NumWeapons = 2;
 
@@ -24,6 +26,8 @@ void UMSWeaponComponent::BeginPlay()
 
     checkf(WeaponData.Num() == NumWeapons, TEXT("Character should hold %d weapons"), NumWeapons);
 
+    FMSComponentRegistry::Get().Register(this);
+
     InitAnimations();
     SpawnWeapons();
     EquipWeapon(CurrentWeaponIndex);
@@ -31,14 +35,34 @@ void UMSWeaponComponent::BeginPlay()
 
 void UMSWeaponComponent::EndPlay(EEndPlayReason::Type Reason)
 {
+    FMSComponentRegistry::Get().Unregister(this);
+
+    if (const ACharacter* Character = Cast<ACharacter>(GetOwner()))
+    {
+        FMSAnimNotifyRouter::Get().Unregister<UMSEquipFinishedAnimNotify>(Character->GetMesh());
+        FMSAnimNotifyRouter::Get().Unregister<UMSReloadFinishedAnimNotify>(Character->GetMesh());
+    }
+
     CurrentWeapon = nullptr;
+    OnWeaponChanged.Broadcast(nullptr);
+
+    UWorld* World = GetWorld();
+    UMSActorPoolSubsystem* ActorPool = World ? World->GetSubsystem<UMSActorPoolSubsystem>() : nullptr;
 
     for (auto Weapon : Weapons)
     {
-        Weapon->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
-        Weapon->Destroy();
+        if (ActorPool)
+        {
+            ActorPool->ReleaseActor(Weapon);
+        }
+        else if (Weapon)
+        {
+            Weapon->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+            Weapon->Destroy();
+        }
     }
     Weapons.Empty();
+    WeaponEquipData.Empty();
 
     Super::EndPlay(Reason);
 }
@@ -72,10 +96,9 @@ void UMSWeaponComponent::NextWeapon()
 
 void UMSWeaponComponent::ToggleFlashlight()
 {
-    // Optimization: Later we can cache accessories in FWeaponData
-    if (auto FlashlightComponent = FCoreUtils::GetActorComponent<UMSWeaponFlashlightComponent>(CurrentWeapon))
+    if (IMSWeaponAccessory* Flashlight = CurrentWeapon ? CurrentWeapon->GetAccessory(EMSWeaponAccessorySlot::Flashlight) : nullptr)
     {
-        FlashlightComponent->Toggle();
+        Flashlight->ToggleAccessory();
     }
 }
 
@@ -92,6 +115,34 @@ bool UMSWeaponComponent::TryToAddAmmo(TSubclassOf<AMSWeapon> WeaponClass, int32
     return false;
 }
 
+void UMSWeaponComponent::ResetWeapons()
+{
+    StopFire();
+
+    // Interrupted montages never send their finish notifies, so pending equip or reload is cancelled here
+    const ACharacter* Character = Cast<ACharacter>(GetOwner());
+    if (UAnimInstance* AnimInstance = Character ? Character->GetMesh()->GetAnimInstance() : nullptr)
+    {
+        AnimInstance->Montage_Stop(0.0f);
+    }
+    bEquipAnimInProgress = false;
+    bReloadAnimInProgress = false;
+
+    for (auto Weapon : Weapons)
+    {
+        if (Weapon)
+        {
+            Weapon->ResetAmmo();
+        }
+    }
+
+    if (CurrentWeaponIndex != 0 && Weapons.Num() > 0)
+    {
+        CurrentWeaponIndex = 0;
+        EquipWeapon(CurrentWeaponIndex);
+    }
+}
+
 bool UMSWeaponComponent::GetWeaponUIData(FWeaponUIData& UIData) const
 {
     if (CurrentWeapon)
@@ -130,22 +181,25 @@ bool UMSWeaponComponent::GetWeaponAmmoData(TSubclassOf<AMSWeapon> WeaponClass, F
 void UMSWeaponComponent::SpawnWeapons()
 {
     ACharacter* Character = Cast<ACharacter>(GetOwner());
-    if (!Character)
+    UMSActorPoolSubsystem* ActorPool = GetWorld()->GetSubsystem<UMSActorPoolSubsystem>();
+    if (!Character || !ActorPool)
     {
         return;
     }
 
     for (auto& OneWeaponData : WeaponData)
     {
-        AMSWeapon* Weapon = GetWorld()->SpawnActor<AMSWeapon>(OneWeaponData.WeaponClass);
+        // Weapons of dead characters are reused on respawn
+        AMSWeapon* Weapon = ActorPool->AcquireActor<AMSWeapon>(OneWeaponData.WeaponClass, Character->GetActorTransform(), Character);
         if (!Weapon)
         {
             continue;
         }
 
-        Weapon->SetOwner(Character);
         Weapon->OnClipEmpty.AddUObject(this, &UMSWeaponComponent::OnEmptyClip);
+        Weapon->OnAmmoChanged.AddUObject(this, &UMSWeaponComponent::OnWeaponAmmoChanged);
         Weapons.Add(Weapon);
+        WeaponEquipData.Add({ OneWeaponData.ReloadAnimMontage });
 
         AttachWeaponToSocket(Weapon, Character->GetMesh(), WeaponArmorySocketName);
     }
@@ -162,7 +216,7 @@ void UMSWeaponComponent::AttachWeaponToSocket(AMSWeapon* Weapon, USceneComponent
 
 void UMSWeaponComponent::EquipWeapon(int32 WeaponIndex)
 {
-    if (WeaponIndex < 0 || WeaponIndex > WeaponData.Num())
+    if (!Weapons.IsValidIndex(WeaponIndex))
     {
         UE_LOG(LogWeaponComponent, Warning, TEXT("Invalid weapon index: %d"), WeaponIndex);
         return;
@@ -186,14 +240,12 @@ void UMSWeaponComponent::EquipWeapon(int32 WeaponIndex)
     CurrentWeapon = Weapons[WeaponIndex];
     AttachWeaponToSocket(CurrentWeapon, Character->GetMesh(), WeaponEquipSocketName);
 
-    // Set and play current reload anim montage
-    const FWeaponData* CurrentWeaponData = WeaponData.FindByPredicate([&](const FWeaponData& Data) { //
-        return Data.WeaponClass == CurrentWeapon->GetClass();
-    });
-    CurrentReloadAnimMontage = CurrentWeaponData ? CurrentWeaponData->ReloadAnimMontage : nullptr;
+    CurrentReloadAnimMontage = WeaponEquipData[WeaponIndex].ReloadAnimMontage;
 
     PlayAnimMontage(EquipAnimMontage);
     bEquipAnimInProgress = true;
+
+    OnWeaponChanged.Broadcast(CurrentWeapon);
 }
 
 void UMSWeaponComponent::PlayAnimMontage(UAnimMontage* AnimMontage)
@@ -209,12 +261,7 @@ void UMSWeaponComponent::PlayAnimMontage(UAnimMontage* AnimMontage)
 
 void UMSWeaponComponent::InitAnimations()
 {
-    auto EquipFinishedNotify = FAnimUtils::FindNotifyByClass<UMSEquipFinishedAnimNotify>(EquipAnimMontage);
-    if (EquipFinishedNotify)
-    {
-        EquipFinishedNotify->OnNotified.AddUObject(this, &UMSWeaponComponent::OnEquipFinished);
-    }
-    else
+    if (!FAnimUtils::FindNotifyByClass<UMSEquipFinishedAnimNotify>(EquipAnimMontage))
     {
         UE_LOG(LogWeaponComponent, Error, TEXT("Equip anim notify is not set"));
         checkNoEntry();
@@ -222,27 +269,29 @@ void UMSWeaponComponent::InitAnimations()
 
     for (auto& OneWeaponData : WeaponData)
     {
-        auto ReloadFinishedNotify = FAnimUtils::FindNotifyByClass<UMSReloadFinishedAnimNotify>(OneWeaponData.ReloadAnimMontage);
-        if (ReloadFinishedNotify)
-        {
-            ReloadFinishedNotify->OnNotified.AddUObject(this, &UMSWeaponComponent::OnReloadFinished);
-        }
-        else
+        if (!FAnimUtils::FindNotifyByClass<UMSReloadFinishedAnimNotify>(OneWeaponData.ReloadAnimMontage))
         {
             UE_LOG(LogWeaponComponent, Error, TEXT("Reload anim notify is not set"));
             checkNoEntry();
         }
     }
-}
 
-void UMSWeaponComponent::OnEquipFinished(USkeletalMeshComponent* MeshComponent)
-{
-    ACharacter* Character = Cast<ACharacter>(GetOwner());
-    if (!Character || MeshComponent != Character->GetMesh())
+    const ACharacter* Character = Cast<ACharacter>(GetOwner());
+    if (!Character)
     {
         return;
     }
 
+    // Notifies are shared by all characters, router calls only the component of notified mesh
+    const auto OnEquipFinishedDelegate = FMSAnimNotifyDelegate::CreateUObject(this, &UMSWeaponComponent::OnEquipFinished);
+    const auto OnReloadFinishedDelegate = FMSAnimNotifyDelegate::CreateUObject(this, &UMSWeaponComponent::OnReloadFinished);
+
+    FMSAnimNotifyRouter::Get().Register<UMSEquipFinishedAnimNotify>(Character->GetMesh(), OnEquipFinishedDelegate);
+    FMSAnimNotifyRouter::Get().Register<UMSReloadFinishedAnimNotify>(Character->GetMesh(), OnReloadFinishedDelegate);
+}
+
+void UMSWeaponComponent::OnEquipFinished(USkeletalMeshComponent* MeshComponent)
+{
     bEquipAnimInProgress = false;
 
     if (CurrentWeapon)
@@ -253,12 +302,6 @@ void UMSWeaponComponent::OnEquipFinished(USkeletalMeshComponent* MeshComponent)
 
 void UMSWeaponComponent::OnReloadFinished(USkeletalMeshComponent* MeshComponent)
 {
-    ACharacter* Character = Cast<ACharacter>(GetOwner());
-    if (!Character || MeshComponent != Character->GetMesh())
-    {
-        return;
-    }
-
     bReloadAnimInProgress = false;
 }
 
@@ -287,3 +330,12 @@ void UMSWeaponComponent::OnEmptyClip(AMSWeapon* Weapon)
         Weapon->ChangeClip();
     }
 }
+
+void UMSWeaponComponent::OnWeaponAmmoChanged(AMSWeapon* Weapon)
+{
+    // HUD shows only current weapon ammo
+    if (CurrentWeapon == Weapon)
+    {
+        OnAmmoChanged.Broadcast(Weapon);
+    }
+}
@@ -0,0 +1,166 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "Core/MSActorPoolSubsystem.h"
+#include "Core/MSPoolableActor.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogActorPool, All, All);
+
+void UMSActorPoolSubsystem::Prewarm(UClass* Class, int32 Count)
+{
+    if (!Class)
+    {
+        return;
+    }
+
+    FMSActorPool& Pool = Pools.FindOrAdd(Class);
+    while (Pool.FreeActors.Num() < Count)
+    {
+        AActor* Actor = SpawnPooledActor(Class, FTransform::Identity, nullptr);
+        if (!Actor)
+        {
+            return;
+        }
+
+        DeactivateActor(Actor);
+        Pool.FreeActors.Add(Actor);
+    }
+}
+
+AActor* UMSActorPoolSubsystem::AcquireActorDeferred(UClass* Class, const FTransform& Transform, AActor* Owner)
+{
+    if (!Class)
+    {
+        return nullptr;
+    }
+
+    FMSActorPool& Pool = Pools.FindOrAdd(Class);
+
+    while (Pool.FreeActors.Num() > 0)
+    {
+        AActor* Actor = Pool.FreeActors.Pop(false);
+        if (IsValid(Actor))
+        {
+            Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+            Actor->SetOwner(Owner);
+
+            ++Pool.NumReused;
+            return Actor;
+        }
+    }
+
+    return SpawnPooledActor(Class, Transform, Owner);
+}
+
+void UMSActorPoolSubsystem::FinishAcquire(AActor* Actor)
+{
+    if (!IsValid(Actor))
+    {
+        return;
+    }
+
+    Actor->SetActorHiddenInGame(false);
+    Actor->SetActorEnableCollision(true);
+    Actor->SetActorTickEnabled(Actor->PrimaryActorTick.bStartWithTickEnabled);
+
+    if (IMSPoolableActor* PoolableActor = Cast<IMSPoolableActor>(Actor))
+    {
+        PoolableActor->OnPoolActivated();
+    }
+
+    ++Pools.FindOrAdd(Actor->GetClass()).NumActive;
+}
+
+void UMSActorPoolSubsystem::ReleaseActor(AActor* Actor)
+{
+    if (!IsValid(Actor))
+    {
+        return;
+    }
+
+    FMSActorPool& Pool = Pools.FindOrAdd(Actor->GetClass());
+    if (Pool.FreeActors.Contains(Actor))
+    {
+        UE_LOG(LogActorPool, Warning, TEXT("Actor %s is already in pool"), *Actor->GetName());
+        return;
+    }
+
+    DeactivateActor(Actor);
+
+    Pool.FreeActors.Add(Actor);
+    Pool.NumActive = FMath::Max(Pool.NumActive - 1, 0);
+}
+
+void UMSActorPoolSubsystem::LogPoolStats() const
+{
+    for (const auto& Pair : Pools)
+    {
+        const FMSActorPool& Pool = Pair.Value;
+        UE_LOG(
+            LogActorPool, Display, TEXT("%s: active %d, free %d, spawned %d, reused %d"),                  //
+            *GetNameSafe(Pair.Key), Pool.NumActive, Pool.FreeActors.Num(), Pool.NumSpawned, Pool.NumReused //
+        );
+    }
+}
+
+void UMSActorPoolSubsystem::Deinitialize()
+{
+    Pools.Empty();
+
+    Super::Deinitialize();
+}
+
+AActor* UMSActorPoolSubsystem::SpawnPooledActor(UClass* Class, const FTransform& Transform, AActor* Owner)
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return nullptr;
+    }
+
+    FActorSpawnParameters SpawnInfo;
+    SpawnInfo.Owner = Owner;
+    SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    AActor* Actor = World->SpawnActor<AActor>(Class, Transform, SpawnInfo);
+    if (Actor)
+    {
+        ++Pools.FindOrAdd(Class).NumSpawned;
+    }
+
+    return Actor;
+}
+
+void UMSActorPoolSubsystem::DeactivateActor(AActor* Actor)
+{
+    if (IMSPoolableActor* PoolableActor = Cast<IMSPoolableActor>(Actor))
+    {
+        PoolableActor->OnPoolDeactivated();
+    }
+
+    Actor->SetLifeSpan(0.0f);
+    Actor->SetActorHiddenInGame(true);
+    Actor->SetActorEnableCollision(false);
+    Actor->SetActorTickEnabled(false);
+    Actor->SetOwner(nullptr);
+}
+
+#if !UE_BUILD_SHIPPING
+
+static void LogPoolStats(UWorld* World)
+{
+    if (const auto ActorPool = World ? World->GetSubsystem<UMSActorPoolSubsystem>() : nullptr)
+    {
+        ActorPool->LogPoolStats();
+    }
+}
+
+static FAutoConsoleCommandWithWorld LogPoolStatsCommand(
+    TEXT("MyShooter.PoolStats"),                                  //
+    TEXT("Log per class stats of actor pool"),                    //
+    FConsoleCommandWithWorldDelegate::CreateStatic(&LogPoolStats) //
+);
+
+#endif
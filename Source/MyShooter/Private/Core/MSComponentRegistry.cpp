@@ -0,0 +1,140 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "Core/MSComponentRegistry.h"
+#include "Components/ActorComponent.h"
+#include "Components/MSHealthComponent.h"
+#include "Components/MSWeaponComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogComponentRegistry, All, All);
+
+FMSComponentRegistry& FMSComponentRegistry::Get()
+{
+    static FMSComponentRegistry Registry;
+    return Registry;
+}
+
+void FMSComponentRegistry::Register(UActorComponent* Component)
+{
+    check(IsInGameThread());
+
+    AActor* Owner = Component ? Component->GetOwner() : nullptr;
+    if (!Owner)
+    {
+        return;
+    }
+
+    FComponentSlots& Slots = ActorComponents.FindOrAdd(Owner);
+
+    // Register component for its class and all parent classes, so lookup by base class works too
+    for (const UClass* Class = Component->GetClass(); Class && Class != UActorComponent::StaticClass(); Class = Class->GetSuperClass())
+    {
+        const int32 Slot = FindOrAddSlot(Class);
+        if (Slots.Num() <= Slot)
+        {
+            Slots.SetNumZeroed(Slot + 1);
+        }
+
+        // First registered component wins as in GetComponentByClass
+        if (!Slots[Slot])
+        {
+            Slots[Slot] = Component;
+        }
+    }
+}
+
+void FMSComponentRegistry::Unregister(UActorComponent* Component)
+{
+    check(IsInGameThread());
+
+    AActor* Owner = Component ? Component->GetOwner() : nullptr;
+    FComponentSlots* Slots = Owner ? ActorComponents.Find(Owner) : nullptr;
+    if (!Slots)
+    {
+        return;
+    }
+
+    bool bEmpty = true;
+    for (UActorComponent*& RegisteredComponent : *Slots)
+    {
+        if (RegisteredComponent == Component)
+        {
+            RegisteredComponent = nullptr;
+        }
+        bEmpty &= RegisteredComponent == nullptr;
+    }
+
+    if (bEmpty)
+    {
+        ActorComponents.Remove(Owner);
+    }
+}
+
+int32 FMSComponentRegistry::FindOrAddSlot(const UClass* Class)
+{
+    if (const int32* Slot = ClassSlots.Find(Class))
+    {
+        return *Slot;
+    }
+
+    return ClassSlots.Add(Class, ClassSlots.Num());
+}
+
+#if !UE_BUILD_SHIPPING
+
+// Compares registry lookup with GetComponentByClass search on a live pawn
+// Usage: MyShooter.BenchComponentLookup [Iterations]
+static void BenchComponentLookup(const TArray<FString>& Args, UWorld* World)
+{
+    if (!World)
+    {
+        return;
+    }
+
+    const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100000;
+
+    APawn* Pawn = nullptr;
+    for (auto It = World->GetPawnIterator(); It && !Pawn; ++It)
+    {
+        Pawn = It->Get();
+    }
+
+    if (!Pawn)
+    {
+        UE_LOG(LogComponentRegistry, Warning, TEXT("No pawn to benchmark component lookup"));
+        return;
+    }
+
+    int32 Found = 0;
+
+    double StartTime = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Iterations; ++i)
+    {
+        Found += FCoreUtils::GetActorComponent<UMSHealthComponent>(Pawn) != nullptr;
+        Found += FCoreUtils::GetActorComponent<UMSWeaponComponent>(Pawn) != nullptr;
+    }
+    const double SearchTime = FPlatformTime::Seconds() - StartTime;
+
+    StartTime = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Iterations; ++i)
+    {
+        Found += FMSComponentRegistry::GetComponent<UMSHealthComponent>(Pawn) != nullptr;
+        Found += FMSComponentRegistry::GetComponent<UMSWeaponComponent>(Pawn) != nullptr;
+    }
+    const double RegistryTime = FPlatformTime::Seconds() - StartTime;
+
+    const double NumLookups = Iterations * 2.0;
+    const double SearchNs = SearchTime * 1e9 / NumLookups;
+    const double RegistryNs = RegistryTime * 1e9 / NumLookups;
+
+    UE_LOG(LogComponentRegistry, Display, TEXT("Lookup time: search %.1f ns, registry %.1f ns (%d found)"), SearchNs, RegistryNs, Found);
+}
+
+static FAutoConsoleCommandWithWorldAndArgs BenchComponentLookupCommand(
+    TEXT("MyShooter.BenchComponentLookup"),                                      //
+    TEXT("Compare component registry lookup with GetComponentByClass search"),   //
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BenchComponentLookup) //
+);
+
+#endif
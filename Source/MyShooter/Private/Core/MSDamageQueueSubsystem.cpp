@@ -0,0 +1,52 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "Core/MSDamageQueueSubsystem.h"
+#include "Components/MSHealthComponent.h"
+#include "Core/MSStats.h"
+#include "Engine/World.h"
+
+void UMSDamageQueueSubsystem::AddTarget(UMSHealthComponent* HealthComponent)
+{
+    if (HealthComponent)
+    {
+        PendingTargets.Add(HealthComponent);
+    }
+}
+
+void UMSDamageQueueSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // Tickables and timers could deal damage too, so queue is resolved after all of them
+    PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UMSDamageQueueSubsystem::OnWorldPostActorTick);
+}
+
+void UMSDamageQueueSubsystem::Deinitialize()
+{
+    FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+    PendingTargets.Empty();
+
+    Super::Deinitialize();
+}
+
+void UMSDamageQueueSubsystem::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+    if (World != GetWorld() || PendingTargets.Num() == 0)
+    {
+        return;
+    }
+
+    MS_SCOPE_CYCLE_COUNTER(ResolveDamageQueue);
+    MS_INC_FRAME_COUNTER_BY(DamagedActors, PendingTargets.Num());
+
+    for (int32 i = 0; i < PendingTargets.Num(); ++i)
+    {
+        // Death handlers could damage other actors, they are added to the end and resolved in this pass
+        if (UMSHealthComponent* HealthComponent = PendingTargets[i].Get())
+        {
+            HealthComponent->ResolvePendingDamage();
+        }
+    }
+
+    PendingTargets.Reset();
+}
@@ -0,0 +1,129 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "Core/MSRegenerationSubsystem.h"
+#include "Components/MSHealthComponent.h"
+#include "Core/MSStats.h"
+#include "Engine/World.h"
+
+void UMSRegenerationSubsystem::StartRegeneration(UMSHealthComponent* HealthComponent, float Delay, float Rate, float MaxHealth)
+{
+    if (!HealthComponent || Rate <= 0.0f)
+    {
+        return;
+    }
+
+    const int32* Index = EntryIndices.Find(HealthComponent);
+    FRegenerationEntry& Entry = Index ? Entries[*Index] : Entries.AddDefaulted_GetRef();
+    if (!Index)
+    {
+        EntryIndices.Add(HealthComponent, Entries.Num() - 1);
+    }
+
+    Entry.HealthComponent = HealthComponent;
+    Entry.HealStartTime = GetWorld()->GetTimeSeconds() + Delay;
+    Entry.Rate = Rate;
+    Entry.MaxHealth = MaxHealth;
+}
+
+void UMSRegenerationSubsystem::StopRegeneration(const UMSHealthComponent* HealthComponent)
+{
+    int32 Index;
+    if (!EntryIndices.RemoveAndCopyValue(HealthComponent, Index))
+    {
+        return;
+    }
+
+    // Health changes in update pass could stop any entry, so they are removed after it
+    if (bUpdating)
+    {
+        Entries[Index].HealthComponent = nullptr;
+        bHasStoppedEntries = true;
+        return;
+    }
+
+    Entries.RemoveAtSwap(Index, 1, false);
+    if (Entries.IsValidIndex(Index))
+    {
+        EntryIndices[Entries[Index].HealthComponent] = Index;
+    }
+}
+
+void UMSRegenerationSubsystem::Deinitialize()
+{
+    Entries.Empty();
+    EntryIndices.Empty();
+
+    Super::Deinitialize();
+}
+
+void UMSRegenerationSubsystem::Tick(float DeltaTime)
+{
+    const float CurrentTime = GetWorld()->GetTimeSeconds();
+    if (CurrentTime - LastUpdateTime < UpdateInterval)
+    {
+        return;
+    }
+
+    MS_SCOPE_CYCLE_COUNTER(Regeneration);
+
+    const float PreviousUpdateTime = LastUpdateTime;
+    LastUpdateTime = CurrentTime;
+
+    TGuardValue<bool> UpdatingGuard(bUpdating, true);
+
+    // Entries started during the pass are added to the end and wait for the next one
+    const int32 NumEntries = Entries.Num();
+    for (int32 i = 0; i < NumEntries; ++i)
+    {
+        const FRegenerationEntry& Entry = Entries[i];
+        UMSHealthComponent* HealthComponent = Entry.HealthComponent;
+        if (!HealthComponent || CurrentTime <= Entry.HealStartTime)
+        {
+            continue;
+        }
+
+        const float HealTime = CurrentTime - FMath::Max(Entry.HealStartTime, PreviousUpdateTime);
+        const float HealAmount = FMath::Min(Entry.Rate * HealTime, Entry.MaxHealth - HealthComponent->GetHealth());
+
+        // Component stops regeneration by itself when health becomes full
+        if (HealAmount > 0.0f)
+        {
+            HealthComponent->TryToAddHealth(HealAmount);
+        }
+        else
+        {
+            StopRegeneration(HealthComponent);
+        }
+    }
+
+    RemoveStoppedEntries();
+}
+
+bool UMSRegenerationSubsystem::IsTickable() const
+{
+    return !HasAnyFlags(RF_ClassDefaultObject) && Entries.Num() > 0;
+}
+
+TStatId UMSRegenerationSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMSRegenerationSubsystem, STATGROUP_Tickables);
+}
+
+void UMSRegenerationSubsystem::RemoveStoppedEntries()
+{
+    if (!bHasStoppedEntries)
+    {
+        return;
+    }
+    bHasStoppedEntries = false;
+
+    Entries.RemoveAllSwap(
+        [](const FRegenerationEntry& Entry) { return !Entry.HealthComponent; }, //
+        false                                                                   //
+    );
+
+    for (int32 i = 0; i < Entries.Num(); ++i)
+    {
+        EntryIndices[Entries[i].HealthComponent] = i;
+    }
+}
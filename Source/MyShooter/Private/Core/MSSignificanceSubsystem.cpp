@@ -0,0 +1,152 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "Core/MSSignificanceSubsystem.h"
+#include "Character/MSCharacter.h"
+#include "Core/MSStats.h"
+#include "AIController.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+void UMSSignificanceSubsystem::AddCharacter(AMSCharacter* Character)
+{
+    if (!Character || !Character->GetMesh())
+    {
+        return;
+    }
+
+    FSignificanceEntry& Entry = Entries.AddDefaulted_GetRef();
+    Entry.Character = Character;
+    Entry.bDefaultUpdateRateOptimizations = Character->GetMesh()->bEnableUpdateRateOptimizations;
+    Entry.DefaultAnimTickOption = Character->GetMesh()->VisibilityBasedAnimTickOption;
+}
+
+void UMSSignificanceSubsystem::RemoveCharacter(AMSCharacter* Character)
+{
+    Entries.RemoveAllSwap(
+        [Character](const FSignificanceEntry& Entry) { return Entry.Character == Character; }, //
+        false                                                                                  //
+    );
+}
+
+void UMSSignificanceSubsystem::Deinitialize()
+{
+    Entries.Empty();
+
+    Super::Deinitialize();
+}
+
+void UMSSignificanceSubsystem::Tick(float DeltaTime)
+{
+    TimeSinceUpdate += DeltaTime;
+    if (TimeSinceUpdate < UpdateInterval)
+    {
+        return;
+    }
+    TimeSinceUpdate = 0.0f;
+
+    MS_SCOPE_CYCLE_COUNTER(Significance);
+
+    // Spectators and benchmark cameras are local players too, so observed viewpoints are included
+    TArray<FVector, TInlineAllocator<4>> ViewLocations;
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PlayerController = It->Get();
+        if (PlayerController && PlayerController->IsLocalController())
+        {
+            FVector ViewLocation;
+            FRotator ViewRotation;
+            PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+            ViewLocations.Add(ViewLocation);
+        }
+    }
+
+    for (FSignificanceEntry& Entry : Entries)
+    {
+        // Controllers keep their tick interval after possessing new pawn, so it's applied again
+        const bool bInCombat = IsInCombat(Entry.Character);
+        const EMSSignificance Significance = GetSignificance(Entry.Character, bInCombat, ViewLocations);
+        if (Significance != Entry.Significance || bInCombat != Entry.bInCombat || Entry.Controller != Entry.Character->GetController())
+        {
+            Entry.Significance = Significance;
+            Entry.bInCombat = bInCombat;
+            Entry.Controller = Entry.Character->GetController();
+            ApplySignificance(Entry);
+        }
+    }
+}
+
+bool UMSSignificanceSubsystem::IsTickable() const
+{
+    return !HasAnyFlags(RF_ClassDefaultObject) && Entries.Num() > 0;
+}
+
+TStatId UMSSignificanceSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMSSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+EMSSignificance UMSSignificanceSubsystem::GetSignificance(
+    const AMSCharacter* Character, bool bInCombat, const TArray<FVector, TInlineAllocator<4>>& ViewLocations) const
+{
+    if (Character->IsLocallyControlled())
+    {
+        return EMSSignificance::High;
+    }
+
+    float MinDistanceSquared = MAX_FLT;
+    for (const FVector& ViewLocation : ViewLocations)
+    {
+        MinDistanceSquared = FMath::Min(MinDistanceSquared, FVector::DistSquared(ViewLocation, Character->GetActorLocation()));
+    }
+
+    if (MinDistanceSquared <= FMath::Square(HighSignificanceDistance))
+    {
+        return EMSSignificance::High;
+    }
+
+    // Bots fighting someone far away keep medium mesh update rate
+    if (bInCombat || MinDistanceSquared <= FMath::Square(MediumSignificanceDistance))
+    {
+        return EMSSignificance::Medium;
+    }
+
+    return EMSSignificance::Low;
+}
+
+void UMSSignificanceSubsystem::ApplySignificance(const FSignificanceEntry& Entry) const
+{
+    USkeletalMeshComponent* Mesh = Entry.Character->GetMesh();
+
+    switch (Entry.Significance)
+    {
+        case EMSSignificance::High:
+            Mesh->bEnableUpdateRateOptimizations = Entry.bDefaultUpdateRateOptimizations;
+            Mesh->VisibilityBasedAnimTickOption = Entry.DefaultAnimTickOption;
+            break;
+
+        case EMSSignificance::Medium:
+            Mesh->bEnableUpdateRateOptimizations = true;
+            Mesh->VisibilityBasedAnimTickOption = Entry.DefaultAnimTickOption;
+            break;
+
+        case EMSSignificance::Low:
+            // Montages still tick, so equip and reload notifies are fired off screen
+            Mesh->bEnableUpdateRateOptimizations = true;
+            Mesh->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+            break;
+    }
+
+    // Controller ticks only to update focus and control rotation, bots in combat tick every frame to keep aiming smoothly
+    if (AAIController* AIController = Entry.Character->GetController<AAIController>())
+    {
+        const float TickIntervals[] = { 0.0f, MediumTickInterval, LowTickInterval };
+        AIController->SetActorTickInterval(Entry.bInCombat ? 0.0f : TickIntervals[static_cast<int32>(Entry.Significance)]);
+    }
+}
+
+bool UMSSignificanceSubsystem::IsInCombat(const AMSCharacter* Character)
+{
+    const AAIController* AIController = Character->GetController<AAIController>();
+    return AIController && AIController->GetFocusActor();
+}
@@ -0,0 +1,33 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "Core/MSStats.h"
+
+CSV_DEFINE_CATEGORY_MODULE(MYSHOOTER_API, MyShooter, true);
+
+DEFINE_STAT(STAT_MS_RifleMakeShot);
+DEFINE_STAT(STAT_MS_LauncherMakeShot);
+DEFINE_STAT(STAT_MS_PlayImpactFX);
+DEFINE_STAT(STAT_MS_GetClosestEnemy);
+DEFINE_STAT(STAT_MS_FindEnemyService);
+DEFINE_STAT(STAT_MS_FireService);
+DEFINE_STAT(STAT_MS_ChangeWeaponService);
+DEFINE_STAT(STAT_MS_OnTakeAnyDamage);
+DEFINE_STAT(STAT_MS_ResetPlayers);
+DEFINE_STAT(STAT_MS_AIUpdate);
+DEFINE_STAT(STAT_MS_FireScheduler);
+DEFINE_STAT(STAT_MS_RadialDamage);
+DEFINE_STAT(STAT_MS_ResolveDamageQueue);
+DEFINE_STAT(STAT_MS_Regeneration);
+DEFINE_STAT(STAT_MS_Significance);
+DEFINE_STAT(STAT_MS_AISense);
+
+DEFINE_STAT(STAT_MS_Shots);
+DEFINE_STAT(STAT_MS_Traces);
+DEFINE_STAT(STAT_MS_Impacts);
+DEFINE_STAT(STAT_MS_SpawnedFX);
+DEFINE_STAT(STAT_MS_AIUpdates);
+DEFINE_STAT(STAT_MS_NavPointCacheHits);
+DEFINE_STAT(STAT_MS_NavPointCacheMisses);
+DEFINE_STAT(STAT_MS_DamagedActors);
+DEFINE_STAT(STAT_MS_SensedBots);
+DEFINE_STAT(STAT_MS_AnimNotifyCallbacks);
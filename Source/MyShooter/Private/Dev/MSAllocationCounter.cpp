@@ -0,0 +1,216 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "Dev/MSAllocationCounter.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/MemoryBase.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAllocationCounter, All, All);
+
+// Forwards everything to wrapped allocator. It's never removed, since memory allocated through it may be freed any time later.
+class FMSCountingMalloc final : public FMalloc
+{
+private:
+    FMalloc* InnerMalloc;
+
+public:
+    explicit FMSCountingMalloc(FMalloc* InInnerMalloc) : InnerMalloc(InInnerMalloc) {}
+
+    virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+    {
+        FMSAllocationCounter::OnAllocation();
+        return InnerMalloc->Malloc(Count, Alignment);
+    }
+
+    virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+    {
+        FMSAllocationCounter::OnAllocation();
+        return InnerMalloc->TryMalloc(Count, Alignment);
+    }
+
+    virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+    {
+        if (Count > 0)
+        {
+            FMSAllocationCounter::OnAllocation();
+        }
+        return InnerMalloc->Realloc(Original, Count, Alignment);
+    }
+
+    virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+    {
+        if (Count > 0)
+        {
+            FMSAllocationCounter::OnAllocation();
+        }
+        return InnerMalloc->TryRealloc(Original, Count, Alignment);
+    }
+
+    virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+
+    virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Count, Alignment); }
+    virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+    virtual void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+    virtual void SetupTLSCachesOnCurrentThread() override { InnerMalloc->SetupTLSCachesOnCurrentThread(); }
+    virtual void ClearAndDisableTLSCachesOnCurrentThread() override { InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread(); }
+    virtual void InitializeStatsMetadata() override { InnerMalloc->InitializeStatsMetadata(); }
+    virtual void UpdateStats() override { InnerMalloc->UpdateStats(); }
+    virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { InnerMalloc->GetAllocatorStats(OutStats); }
+    virtual void DumpAllocatorStats(FOutputDevice& Ar) override { InnerMalloc->DumpAllocatorStats(Ar); }
+    virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+    virtual bool ValidateHeap() override { return InnerMalloc->ValidateHeap(); }
+    virtual const TCHAR* GetDescriptiveName() override { return InnerMalloc->GetDescriptiveName(); }
+};
+
+bool FMSAllocationCounter::bInstalled = false;
+bool FMSAllocationCounter::bEnabled = false;
+FMSAllocationScope* FMSAllocationCounter::CurrentScope = nullptr;
+
+void FMSAllocationCounter::Install()
+{
+    check(IsInGameThread());
+
+    if (bInstalled)
+    {
+        return;
+    }
+
+    // Called once from module startup. Proxy forwards to previous allocator, so memory allocated before the swap
+    // or by threads still holding previous pointer is freed by the same inner allocator.
+    FMalloc* InnerMalloc = GMalloc;
+    FMalloc* CountingMalloc = new FMSCountingMalloc(InnerMalloc);
+    FPlatformAtomics::InterlockedExchangePtr(reinterpret_cast<void**>(&GMalloc), CountingMalloc);
+    bInstalled = true;
+}
+
+void FMSAllocationCounter::SetEnabled(bool bInEnabled)
+{
+    check(IsInGameThread());
+
+    if (bInEnabled && !bInstalled)
+    {
+        UE_LOG(LogAllocationCounter, Warning, TEXT("Allocation counting requires -MSCountAllocations on command line"));
+        return;
+    }
+
+    bEnabled = bInEnabled;
+}
+
+void FMSAllocationCounter::LogStats()
+{
+    const TCHAR* State = bEnabled ? TEXT("enabled") : TEXT("disabled");
+    UE_LOG(LogAllocationCounter, Display, TEXT("Heap allocations per scope, counting is %s"), State);
+
+    for (const auto& Pair : GetScopeStats())
+    {
+        const FScopeStats& Stats = Pair.Value;
+        if (Stats.NumAllocations == 0)
+        {
+            UE_LOG(LogAllocationCounter, Display, TEXT("%s: %d calls, no allocations"), Pair.Key, Stats.NumCalls);
+            continue;
+        }
+
+        const float AvgAllocations = static_cast<float>(Stats.NumAllocations) / Stats.NumCalls;
+
+        UE_LOG(
+            LogAllocationCounter, Warning, TEXT("%s: %d calls, %lld allocations, %.2f per call, max %d"), //
+            Pair.Key, Stats.NumCalls, Stats.NumAllocations, AvgAllocations, Stats.MaxAllocations          //
+        );
+    }
+}
+
+void FMSAllocationCounter::ResetStats()
+{
+    GetScopeStats().Empty();
+}
+
+bool FMSAllocationCounter::FindScopeStats(const TCHAR* Name, int32& OutNumCalls, int64& OutNumAllocations)
+{
+    // Scope names are keyed by literal pointer, which may differ between translation units
+    for (const auto& Pair : GetScopeStats())
+    {
+        if (FCString::Strcmp(Pair.Key, Name) == 0)
+        {
+            OutNumCalls = Pair.Value.NumCalls;
+            OutNumAllocations = Pair.Value.NumAllocations;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+TMap<const TCHAR*, FMSAllocationCounter::FScopeStats>& FMSAllocationCounter::GetScopeStats()
+{
+    static TMap<const TCHAR*, FScopeStats> ScopeStats;
+    return ScopeStats;
+}
+
+void FMSAllocationCounter::OnAllocation()
+{
+    // Scopes are game thread only, allocations of workers don't belong to them
+    if (CurrentScope && IsInGameThread())
+    {
+        ++CurrentScope->NumAllocations;
+    }
+}
+
+FMSAllocationScope::FMSAllocationScope(const TCHAR* InName) : Name(InName)
+{
+    if (FMSAllocationCounter::IsEnabled() && IsInGameThread())
+    {
+        bActive = true;
+        ParentScope = FMSAllocationCounter::CurrentScope;
+        FMSAllocationCounter::CurrentScope = this;
+    }
+}
+
+FMSAllocationScope::~FMSAllocationScope()
+{
+    if (!bActive)
+    {
+        return;
+    }
+
+    // Stats map may allocate itself, so it's updated outside of any scope
+    FMSAllocationCounter::CurrentScope = nullptr;
+
+    FMSAllocationCounter::FScopeStats& Stats = FMSAllocationCounter::GetScopeStats().FindOrAdd(Name);
+    ++Stats.NumCalls;
+    Stats.NumAllocations += NumAllocations;
+    Stats.MaxAllocations = FMath::Max(Stats.MaxAllocations, NumAllocations);
+
+    FMSAllocationCounter::CurrentScope = ParentScope;
+}
+
+static void SetAllocationCounting(const TArray<FString>& Args)
+{
+    const bool bEnabled = Args.Num() == 0 || FCString::Atoi(*Args[0]) != 0;
+    if (bEnabled)
+    {
+        FMSAllocationCounter::ResetStats();
+    }
+
+    FMSAllocationCounter::SetEnabled(bEnabled);
+}
+
+static void LogAllocationStats()
+{
+    FMSAllocationCounter::LogStats();
+}
+
+static FAutoConsoleCommand SetAllocationCountingCommand(
+    TEXT("MyShooter.CountAllocations"),                                                                                //
+    TEXT("1 - reset and start counting heap allocations of hot gameplay scopes, 0 - stop. Needs -MSCountAllocations"), //
+    FConsoleCommandWithArgsDelegate::CreateStatic(&SetAllocationCounting)                                              //
+);
+
+static FAutoConsoleCommand LogAllocationStatsCommand(
+    TEXT("MyShooter.AllocationStats"),                                            //
+    TEXT("Log heap allocations per call of hot gameplay scopes, e.g. RifleShot"), //
+    FConsoleCommandDelegate::CreateStatic(&LogAllocationStats)                    //
+);
+
+#endif
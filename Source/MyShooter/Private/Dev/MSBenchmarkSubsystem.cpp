@@ -0,0 +1,149 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "Dev/MSBenchmarkSubsystem.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogBenchmark, All, All);
+
+static float GetPercentile(const TArray<float>& SortedValues, float Percentile)
+{
+    if (SortedValues.Num() == 0)
+    {
+        return 0.0f;
+    }
+
+    const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile * SortedValues.Num()) - 1, 0, SortedValues.Num() - 1);
+    return SortedValues[Index];
+}
+
+bool UMSBenchmarkSubsystem::ParseCommandLine(FBenchmarkSettings& OutSettings)
+{
+    const TCHAR* CommandLine = FCommandLine::Get();
+    if (!FParse::Param(CommandLine, TEXT("MSBenchmark")))
+    {
+        return false;
+    }
+
+    FParse::Value(CommandLine, TEXT("Bots="), OutSettings.NumBots);
+    FParse::Value(CommandLine, TEXT("Rounds="), OutSettings.NumRounds);
+    FParse::Value(CommandLine, TEXT("RoundTime="), OutSettings.RoundTime);
+    FParse::Value(CommandLine, TEXT("Seed="), OutSettings.Seed);
+
+    if (!FParse::Value(CommandLine, TEXT("BenchmarkCSV="), OutSettings.CSVPath))
+    {
+        OutSettings.CSVPath = FPaths::ProfilingDir() / TEXT("MyShooterBenchmark.csv");
+    }
+
+    OutSettings.NumBots = FMath::Max(OutSettings.NumBots, 1);
+    OutSettings.NumRounds = FMath::Max(OutSettings.NumRounds, 1);
+    OutSettings.RoundTime = FMath::Max(OutSettings.RoundTime, 1);
+
+    return true;
+}
+
+void UMSBenchmarkSubsystem::StartBenchmark(const FBenchmarkSettings& InSettings)
+{
+    Settings = InSettings;
+    bRunning = true;
+
+    FrameTimes.Reset();
+    GameThreadTimes.Reset();
+    ActorCountSum = 0;
+    MaxActorCount = 0;
+    NumShotsFired = 0;
+    StartTime = FPlatformTime::Seconds();
+
+    RoundResetTimeSum = 0.0f;
+    MaxRoundResetTime = 0.0f;
+    NumRoundResets = 0;
+
+    UE_LOG(
+        LogBenchmark, Display, TEXT("Benchmark started: bots %d, rounds %d, round time %d, seed %d"), //
+        Settings.NumBots, Settings.NumRounds, Settings.RoundTime, Settings.Seed                       //
+    );
+}
+
+void UMSBenchmarkSubsystem::FinishBenchmark()
+{
+    if (!bRunning)
+    {
+        return;
+    }
+
+    bRunning = false;
+    WriteCSV();
+}
+
+void UMSBenchmarkSubsystem::AddRoundReset(float ResetTime)
+{
+    // First round starts before benchmark, so only round transitions are counted
+    if (!bRunning)
+    {
+        return;
+    }
+
+    RoundResetTimeSum += ResetTime;
+    MaxRoundResetTime = FMath::Max(MaxRoundResetTime, ResetTime);
+    ++NumRoundResets;
+}
+
+void UMSBenchmarkSubsystem::Tick(float DeltaTime)
+{
+    const int32 ActorCount = GetWorld()->GetActorCount();
+
+    FrameTimes.Add(FApp::GetDeltaTime() * 1000.0f);
+    GameThreadTimes.Add(FPlatformTime::ToMilliseconds(GGameThreadTime));
+    ActorCountSum += ActorCount;
+    MaxActorCount = FMath::Max(MaxActorCount, ActorCount);
+}
+
+TStatId UMSBenchmarkSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMSBenchmarkSubsystem, STATGROUP_Tickables);
+}
+
+void UMSBenchmarkSubsystem::WriteCSV() const
+{
+    TArray<float> SortedFrameTimes = FrameTimes;
+    TArray<float> SortedGameThreadTimes = GameThreadTimes;
+    SortedFrameTimes.Sort();
+    SortedGameThreadTimes.Sort();
+
+    const int32 NumFrames = FrameTimes.Num();
+    const float AvgActorCount = NumFrames > 0 ? static_cast<float>(ActorCountSum) / NumFrames : 0.0f;
+    const double Duration = FPlatformTime::Seconds() - StartTime;
+    const float AvgRoundResetTime = NumRoundResets > 0 ? RoundResetTimeSum / NumRoundResets : 0.0f;
+
+    FString CSV;
+    if (!IFileManager::Get().FileExists(*Settings.CSVPath))
+    {
+        CSV += TEXT("Build,Bots,Rounds,RoundTime,Seed,Frames,Duration,FrameP50,FrameP90,FrameP99,FrameMax,")
+               TEXT("GameThreadP50,GameThreadP90,GameThreadP99,AvgActors,MaxActors,ShotsFired,")
+               TEXT("RoundResetAvg,RoundResetMax\n");
+    }
+
+    CSV += FString::Printf(
+        TEXT("%s,%d,%d,%d,%d,%d,%.2f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.1f,%d,%d,%.3f,%.3f\n"),                              //
+        FApp::GetBuildVersion(), Settings.NumBots, Settings.NumRounds, Settings.RoundTime, Settings.Seed, NumFrames, Duration, //
+        GetPercentile(SortedFrameTimes, 0.5f), GetPercentile(SortedFrameTimes, 0.9f), GetPercentile(SortedFrameTimes, 0.99f),  //
+        SortedFrameTimes.Num() > 0 ? SortedFrameTimes.Last() : 0.0f,                                                           //
+        GetPercentile(SortedGameThreadTimes, 0.5f), GetPercentile(SortedGameThreadTimes, 0.9f),                                //
+        GetPercentile(SortedGameThreadTimes, 0.99f), AvgActorCount, MaxActorCount, NumShotsFired,                              //
+        AvgRoundResetTime, MaxRoundResetTime                                                                                   //
+    );
+
+    const auto Encoding = FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM;
+    if (FFileHelper::SaveStringToFile(CSV, *Settings.CSVPath, Encoding, &IFileManager::Get(), FILEWRITE_Append))
+    {
+        UE_LOG(LogBenchmark, Display, TEXT("Benchmark finished: %d frames, results written to %s"), NumFrames, *Settings.CSVPath);
+    }
+    else
+    {
+        UE_LOG(LogBenchmark, Error, TEXT("Can't write benchmark results to %s"), *Settings.CSVPath);
+    }
+}
@@ -2,7 +2,7 @@
 
 #include "Dev/MSDevDamageActor.h"
 #include "DrawDebugHelpers.h"
-#include "Kismet/GameplayStatics.h"
+#include "Weapon/MSRadialDamageSubsystem.h"
 
 AMSDevDamageActor::AMSDevDamageActor()
 {
@@ -23,5 +23,17 @@ void AMSDevDamageActor::Tick(float DeltaTime)
 	Super::Tick(DeltaTime);
 
     DrawDebugSphere(GetWorld(), GetActorLocation(), Radius, 24, SphereColor);
-    UGameplayStatics::ApplyRadialDamage(GetWorld(), Damage, GetActorLocation(), Radius, DamageType, {}, this, nullptr, bDoFullDamage);
+
+    if (UMSRadialDamageSubsystem* RadialDamage = GetWorld()->GetSubsystem<UMSRadialDamageSubsystem>())
+    {
+        FMSRadialDamageParams DamageParams;
+        DamageParams.BaseDamage = Damage;
+        DamageParams.Origin = GetActorLocation();
+        DamageParams.Radius = Radius;
+        DamageParams.bDoFullDamage = bDoFullDamage;
+        DamageParams.DamageType = DamageType;
+        DamageParams.DamageCauser = this;
+
+        RadialDamage->ApplyRadialDamage(DamageParams);
+    }
 }
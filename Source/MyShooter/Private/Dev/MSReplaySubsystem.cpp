@@ -0,0 +1,317 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "Dev/MSReplaySubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogReplay, All, All);
+
+static constexpr uint32 ReplayMagic = 0x5052534D; // "MSRP"
+static constexpr int32 ReplayVersion = 1;
+
+static constexpr uint8 InputFlagAxis = 1 << 0;
+static constexpr uint8 InputFlagGamepad = 1 << 1;
+
+void UMSReplaySubsystem::StartFromCommandLine(FBenchmarkSettings& InOutSettings)
+{
+    const TCHAR* CommandLine = FCommandLine::Get();
+
+    FString Path;
+    if (FParse::Value(CommandLine, TEXT("MSReplay="), Path))
+    {
+        if (!LoadReplay(Path))
+        {
+            return;
+        }
+
+        // Match is played with recorded settings, results still go to benchmark CSV of this run
+        InOutSettings.NumBots = Settings.NumBots;
+        InOutSettings.NumRounds = Settings.NumRounds;
+        InOutSettings.RoundTime = Settings.RoundTime;
+        InOutSettings.Seed = Settings.Seed;
+
+        Mode = EReplayMode::Replaying;
+
+        // Every frame is simulated with recorded delta time
+        FApp::SetUseFixedTimeStep(true);
+        FApp::SetFixedDeltaTime(Frames.Num() > 0 ? Frames[0].DeltaTime : FApp::GetFixedDeltaTime());
+
+        UE_LOG(LogReplay, Display, TEXT("Replay started: %d frames, %d inputs from %s"), Frames.Num(), Inputs.Num(), *Path);
+    }
+    else if (FParse::Value(CommandLine, TEXT("MSRecord="), Path))
+    {
+        Settings = InOutSettings;
+        Mode = EReplayMode::Recording;
+
+        UE_LOG(LogReplay, Display, TEXT("Recording started to %s"), *Path);
+    }
+    else
+    {
+        return;
+    }
+
+    FilePath = Path;
+    CurrentFrame = 0;
+    NextInputIndex = 0;
+
+    WorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddUObject(this, &UMSReplaySubsystem::OnWorldTickStart);
+}
+
+void UMSReplaySubsystem::FinishRecording()
+{
+    if (!IsRecording())
+    {
+        return;
+    }
+
+    // Inputs after the last frame start aren't processed by the match
+    Inputs.SetNum(NextInputIndex);
+
+    if (SaveReplay())
+    {
+        UE_LOG(LogReplay, Display, TEXT("Recording finished: %d frames, %d inputs written to %s"), Frames.Num(), Inputs.Num(), *FilePath);
+    }
+    else
+    {
+        UE_LOG(LogReplay, Error, TEXT("Can't write recording to %s"), *FilePath);
+    }
+
+    Mode = EReplayMode::None;
+    FWorldDelegates::OnWorldTickStart.Remove(WorldTickStartHandle);
+}
+
+void UMSReplaySubsystem::SetMatchSeed(int32 Seed)
+{
+    MatchSeed = Seed;
+    NextStreamIndex = 0;
+}
+
+FRandomStream UMSReplaySubsystem::MakeRandomStream()
+{
+    return FRandomStream(static_cast<int32>(HashCombine(GetTypeHash(MatchSeed), GetTypeHash(NextStreamIndex++))));
+}
+
+void UMSReplaySubsystem::RecordKey(const FKey& Key, EInputEvent EventType, float AmountDepressed, bool bGamepad)
+{
+    AddInput(Key, bGamepad ? InputFlagGamepad : 0, static_cast<uint8>(EventType), AmountDepressed);
+}
+
+void UMSReplaySubsystem::RecordAxis(const FKey& Key, float Delta, int32 NumSamples, bool bGamepad)
+{
+    const uint8 Flags = InputFlagAxis | (bGamepad ? InputFlagGamepad : 0);
+    AddInput(Key, Flags, static_cast<uint8>(FMath::Clamp(NumSamples, 0, 255)), Delta);
+}
+
+void UMSReplaySubsystem::Deinitialize()
+{
+    FinishRecording();
+    FinishReplay();
+
+    Frames.Empty();
+    Inputs.Empty();
+    KeyNames.Empty();
+    KeyIndices.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UMSReplaySubsystem::LoadReplay(const FString& Path)
+{
+    TArray<uint8> Data;
+    if (!FFileHelper::LoadFileToArray(Data, *Path))
+    {
+        UE_LOG(LogReplay, Error, TEXT("Can't read replay %s"), *Path);
+        return false;
+    }
+
+    FMemoryReader Reader(Data);
+
+    uint32 Magic = 0;
+    int32 Version = 0;
+    Reader << Magic << Version;
+    if (Magic != ReplayMagic || Version != ReplayVersion)
+    {
+        UE_LOG(LogReplay, Error, TEXT("Replay %s has unsupported format"), *Path);
+        return false;
+    }
+
+    Reader << Settings.Seed << Settings.NumBots << Settings.NumRounds << Settings.RoundTime;
+
+    TArray<FString> KeyStrings;
+    Reader << KeyStrings;
+    KeyNames.Reset(KeyStrings.Num());
+    for (const FString& KeyString : KeyStrings)
+    {
+        KeyNames.Add(FName(*KeyString));
+    }
+
+    int32 NumFrames = 0;
+    Reader << NumFrames;
+    Frames.SetNum(FMath::Max(NumFrames, 0));
+    Inputs.Reset();
+
+    for (FFrameRecord& Frame : Frames)
+    {
+        Reader << Frame.DeltaTime << Frame.NumInputs;
+        for (int32 i = 0; i < Frame.NumInputs && !Reader.IsError(); ++i)
+        {
+            Reader << Inputs.AddDefaulted_GetRef();
+        }
+    }
+
+    if (Reader.IsError())
+    {
+        UE_LOG(LogReplay, Error, TEXT("Replay %s is corrupted"), *Path);
+        Frames.Empty();
+        Inputs.Empty();
+        return false;
+    }
+
+    return true;
+}
+
+bool UMSReplaySubsystem::SaveReplay() const
+{
+    TArray<uint8> Data;
+    FMemoryWriter Writer(Data);
+
+    uint32 Magic = ReplayMagic;
+    int32 Version = ReplayVersion;
+    FBenchmarkSettings SavedSettings = Settings;
+    Writer << Magic << Version;
+    Writer << SavedSettings.Seed << SavedSettings.NumBots << SavedSettings.NumRounds << SavedSettings.RoundTime;
+
+    TArray<FString> KeyStrings;
+    for (const FName& KeyName : KeyNames)
+    {
+        KeyStrings.Add(KeyName.ToString());
+    }
+    Writer << KeyStrings;
+
+    int32 NumFrames = Frames.Num();
+    Writer << NumFrames;
+
+    int32 InputIndex = 0;
+    for (FFrameRecord Frame : Frames)
+    {
+        Writer << Frame.DeltaTime << Frame.NumInputs;
+        for (int32 i = 0; i < Frame.NumInputs; ++i)
+        {
+            FInputRecord Input = Inputs[InputIndex++];
+            Writer << Input;
+        }
+    }
+
+    return FFileHelper::SaveArrayToFile(Data, *FilePath);
+}
+
+void UMSReplaySubsystem::AddInput(const FKey& Key, uint8 Flags, uint8 EventOrSamples, float Value)
+{
+    if (!IsRecording())
+    {
+        return;
+    }
+
+    const FName KeyName = Key.GetFName();
+    const int32* KeyIndex = KeyIndices.Find(KeyName);
+    if (!KeyIndex)
+    {
+        KeyIndex = &KeyIndices.Add(KeyName, KeyNames.Add(KeyName));
+    }
+
+    FInputRecord& Input = Inputs.AddDefaulted_GetRef();
+    Input.KeyIndex = static_cast<uint16>(*KeyIndex);
+    Input.Flags = Flags;
+    Input.EventOrSamples = EventOrSamples;
+    Input.Value = Value;
+}
+
+void UMSReplaySubsystem::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+    if (World != GetWorld())
+    {
+        return;
+    }
+
+    // Input received before world tick is processed by player controller in this frame
+    if (IsRecording())
+    {
+        FFrameRecord& Frame = Frames.AddDefaulted_GetRef();
+        Frame.DeltaTime = DeltaSeconds;
+        Frame.NumInputs = static_cast<uint16>(FMath::Min(Inputs.Num() - NextInputIndex, static_cast<int32>(MAX_uint16)));
+
+        NextInputIndex += Frame.NumInputs;
+        Inputs.SetNum(NextInputIndex, false);
+        return;
+    }
+
+    if (!IsReplaying())
+    {
+        return;
+    }
+
+    if (!Frames.IsValidIndex(CurrentFrame))
+    {
+        UE_LOG(LogReplay, Display, TEXT("Replay finished: %d frames"), CurrentFrame);
+        FinishReplay();
+        return;
+    }
+
+    InjectFrameInput(Frames[CurrentFrame], DeltaSeconds);
+    ++CurrentFrame;
+
+    if (Frames.IsValidIndex(CurrentFrame))
+    {
+        FApp::SetFixedDeltaTime(Frames[CurrentFrame].DeltaTime);
+    }
+}
+
+void UMSReplaySubsystem::InjectFrameInput(const FFrameRecord& Frame, float DeltaTime)
+{
+    APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+    if (!PlayerController)
+    {
+        NextInputIndex += Frame.NumInputs;
+        return;
+    }
+
+    TGuardValue<bool> InjectingGuard(bInjectingInput, true);
+
+    for (int32 i = 0; i < Frame.NumInputs; ++i)
+    {
+        const FInputRecord& Input = Inputs[NextInputIndex++];
+        if (!KeyNames.IsValidIndex(Input.KeyIndex))
+        {
+            continue;
+        }
+
+        const FKey Key(KeyNames[Input.KeyIndex]);
+        const bool bGamepad = (Input.Flags & InputFlagGamepad) != 0;
+
+        if (Input.Flags & InputFlagAxis)
+        {
+            PlayerController->InputAxis(Key, Input.Value, DeltaTime, Input.EventOrSamples, bGamepad);
+        }
+        else
+        {
+            PlayerController->InputKey(Key, static_cast<EInputEvent>(Input.EventOrSamples), Input.Value, bGamepad);
+        }
+    }
+}
+
+void UMSReplaySubsystem::FinishReplay()
+{
+    if (!IsReplaying())
+    {
+        return;
+    }
+
+    Mode = EReplayMode::None;
+    FApp::SetUseFixedTimeStep(false);
+    FWorldDelegates::OnWorldTickStart.Remove(WorldTickStartHandle);
+}
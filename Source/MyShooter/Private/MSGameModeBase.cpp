@@ -6,9 +6,21 @@
 #include "Player/MSPlayerState.h"
 #include "AIController.h"
 #include "AI/MSAICharacter.h"
+#include "AI/MSAIController.h"
+#include "Core/MSStats.h"
+#include "Dev/MSReplaySubsystem.h"
+#include "HAL/IConsoleManager.h"
+#include "Materials/MaterialInstanceDynamic.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogMSGameModeBase, All, All);
 
+static TAutoConsoleVariable<int32> CVarIncrementalRoundReset(
+    TEXT("MyShooter.IncrementalRoundReset"),                                                     //
+    1,                                                                                           //
+    TEXT("1 - living players are reset in place on round start, 0 - all players are respawned"), //
+    ECVF_Default                                                                                 //
+);
+
 AMSGameModeBase::AMSGameModeBase()
 {
     DefaultPawnClass = AMSCharacter::StaticClass();
@@ -16,15 +28,54 @@ AMSGameModeBase::AMSGameModeBase()
     PlayerStateClass = AMSPlayerState::StaticClass();
 }
 
+void AMSGameModeBase::InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage)
+{
+    Super::InitGame(MapName, Options, ErrorMessage);
+
+    UMSReplaySubsystem* Replay = GetWorld()->GetSubsystem<UMSReplaySubsystem>();
+
+    bBenchmarkMode = UMSBenchmarkSubsystem::ParseCommandLine(BenchmarkSettings);
+    if (bBenchmarkMode)
+    {
+        // Replayed match takes bots, rounds and seed from recording
+        if (Replay)
+        {
+            Replay->StartFromCommandLine(BenchmarkSettings);
+        }
+
+        // Only bots are playing, NumPlayers includes player slot
+        NumPlayers = BenchmarkSettings.NumBots + 1;
+        NumRounds = BenchmarkSettings.NumRounds;
+        RoundTime = BenchmarkSettings.RoundTime;
+    }
+
+    // Weapons and bots take random streams from match seed
+    if (Replay)
+    {
+        Replay->SetMatchSeed(bBenchmarkMode ? BenchmarkSettings.Seed : FMath::Rand());
+    }
+}
+
 void AMSGameModeBase::StartPlay()
 {
     Super::StartPlay();
 
+    if (bBenchmarkMode)
+    {
+        FMath::RandInit(BenchmarkSettings.Seed);
+        FMath::SRandInit(BenchmarkSettings.Seed);
+    }
+
     SpawnBots();
     SetTeamInfo();
 
     CurrentRound = 1;
     StartRound();
+
+    if (UMSBenchmarkSubsystem* Benchmark = GetBenchmarkSubsystem())
+    {
+        Benchmark->StartBenchmark(BenchmarkSettings);
+    }
 }
 
 UClass* AMSGameModeBase::GetDefaultPawnClassForController_Implementation(AController* InController)
@@ -37,6 +88,11 @@ UClass* AMSGameModeBase::GetDefaultPawnClassForController_Implementation(AContro
     return Super::GetDefaultPawnClassForController_Implementation(InController);
 }
 
+bool AMSGameModeBase::PlayerCanRestart_Implementation(APlayerController* Player)
+{
+    return CanRestartController(Player) && Super::PlayerCanRestart_Implementation(Player);
+}
+
 void AMSGameModeBase::SpawnBots()
 {
     UWorld* World = GetWorld();
@@ -101,10 +157,34 @@ void AMSGameModeBase::SetCharacterColor(AController* Controller)
 
     if (Character && PlayerState)
     {
-        Character->SetCharacterColor(PlayerState->GetTeamColor());
+        const FName ColorParameterName = Character->GetMaterialColorName();
+        Character->SetCharacterMaterial(GetTeamMaterial(Character->GetBaseMaterial(), PlayerState->GetTeamColor(), ColorParameterName));
     }
 }
 
+UMaterialInstanceDynamic* AMSGameModeBase::GetTeamMaterial(
+    UMaterialInterface* BaseMaterial, const FLinearColor& Color, FName ColorParameterName)
+{
+    if (!BaseMaterial)
+    {
+        return nullptr;
+    }
+
+    const TPair<const UMaterialInterface*, FLinearColor> Key(BaseMaterial, Color);
+    if (UMaterialInstanceDynamic** TeamMaterial = TeamMaterialCache.Find(Key))
+    {
+        return *TeamMaterial;
+    }
+
+    UMaterialInstanceDynamic* TeamMaterial = UMaterialInstanceDynamic::Create(BaseMaterial, this);
+    TeamMaterial->SetVectorParameterValue(ColorParameterName, Color);
+
+    TeamMaterials.Add(TeamMaterial);
+    TeamMaterialCache.Add(Key, TeamMaterial);
+
+    return TeamMaterial;
+}
+
 void AMSGameModeBase::StartRound()
 {
     ResetPlayers();
@@ -130,29 +210,130 @@ void AMSGameModeBase::OnRoundUpdate()
         else
         {
             UE_LOG(LogMSGameModeBase, Display, TEXT("Round over"));
+
+            if (bBenchmarkMode)
+            {
+                FinishBenchmark();
+            }
         }
     }
 }
 
 void AMSGameModeBase::ResetPlayers()
 {
+    MS_SCOPE_CYCLE_COUNTER(ResetPlayers);
+
     UWorld* World = GetWorld();
     if (!World)
     {
         return;
     }
 
+    const double StartTime = FPlatformTime::Seconds();
+    const bool bIncrementalReset = CVarIncrementalRoundReset.GetValueOnGameThread() != 0;
+
+    int32 NumResetInPlace = 0;
+    int32 NumRespawned = 0;
+
     for (auto It = World->GetControllerIterator(); It; ++It)
     {
-        if (AController* Controller = It->Get())
+        AController* Controller = It->Get();
+        if (!Controller || !CanRestartController(Controller))
         {
-            if (APawn* Pawn = Controller->GetPawn())
-            {
-                Pawn->Reset();
-            }
+            continue;
+        }
 
-            RestartPlayer(Controller);
-            SetCharacterColor(Controller);
+        if (bIncrementalReset && ResetPlayerInPlace(Controller))
+        {
+            ++NumResetInPlace;
+            continue;
+        }
+
+        if (APawn* Pawn = Controller->GetPawn())
+        {
+            Pawn->Reset();
         }
+
+        RestartPlayer(Controller);
+        SetCharacterColor(Controller);
+
+        ++NumRespawned;
+    }
+
+    const float ResetTime = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+    UE_LOG(LogMSGameModeBase, Display, TEXT("Round reset %.2f ms: %d in place, %d respawned"), ResetTime, NumResetInPlace, NumRespawned);
+
+    if (UMSBenchmarkSubsystem* Benchmark = GetBenchmarkSubsystem())
+    {
+        Benchmark->AddRoundReset(ResetTime);
+    }
+}
+
+bool AMSGameModeBase::ResetPlayerInPlace(AController* Controller)
+{
+    AMSCharacter* Character = Cast<AMSCharacter>(Controller->GetPawn());
+    if (!Character || Character->IsPendingKillPending())
+    {
+        return false;
+    }
+
+    AActor* StartSpot = FindPlayerStart(Controller);
+    if (!StartSpot)
+    {
+        return false;
+    }
+
+    // Keep pawn, its weapons and material, dead characters are respawned
+    if (!Character->ResetForRound())
+    {
+        return false;
+    }
+
+    const FRotator StartRotation(0.0f, StartSpot->GetActorRotation().Yaw, 0.0f);
+    if (!Character->TeleportTo(StartSpot->GetActorLocation(), StartRotation))
+    {
+        return false;
     }
+
+    Controller->SetControlRotation(StartRotation);
+
+    if (const auto AIController = Cast<AMSAIController>(Controller))
+    {
+        AIController->ResetForRound();
+    }
+
+    return true;
+}
+
+bool AMSGameModeBase::CanRestartController(AController* Controller) const
+{
+    if (!bBenchmarkMode || !Controller || !Controller->IsPlayerController())
+    {
+        return true;
+    }
+
+    // Benchmark runs without player, except recorded and replayed matches where player input drives the pawn
+    const UMSReplaySubsystem* Replay = GetWorld()->GetSubsystem<UMSReplaySubsystem>();
+    return Replay && (Replay->IsRecording() || Replay->IsReplaying());
+}
+
+UMSBenchmarkSubsystem* AMSGameModeBase::GetBenchmarkSubsystem() const
+{
+    const UWorld* World = GetWorld();
+    return bBenchmarkMode && World ? World->GetSubsystem<UMSBenchmarkSubsystem>() : nullptr;
+}
+
+void AMSGameModeBase::FinishBenchmark()
+{
+    if (UMSBenchmarkSubsystem* Benchmark = GetBenchmarkSubsystem())
+    {
+        Benchmark->FinishBenchmark();
+    }
+
+    if (UMSReplaySubsystem* Replay = GetWorld()->GetSubsystem<UMSReplaySubsystem>())
+    {
+        Replay->FinishRecording();
+    }
+
+    FPlatformMisc::RequestExit(false);
 }
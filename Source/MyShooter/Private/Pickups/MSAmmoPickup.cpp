@@ -3,18 +3,18 @@
 #include "Pickups/MSAmmoPickup.h"
 #include "Components/MSHealthComponent.h"
 #include "Components/MSWeaponComponent.h"
-#include "Core/CoreUtils.h"
+#include "Core/MSComponentRegistry.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogAmmoPickup, All, All);
 
 bool AMSAmmoPickup::GivePickupTo(APawn* Pawn)
 {
-    auto HealthComponent = FCoreUtils::GetActorComponent<UMSHealthComponent>(Pawn);
+    auto HealthComponent = FMSComponentRegistry::GetComponent<UMSHealthComponent>(Pawn);
     if (!HealthComponent || HealthComponent->IsDead())
     {
         return false;
     }
 
-    auto WeaponComponent = FCoreUtils::GetActorComponent<UMSWeaponComponent>(Pawn);
+    auto WeaponComponent = FMSComponentRegistry::GetComponent<UMSWeaponComponent>(Pawn);
     return WeaponComponent && WeaponComponent->TryToAddAmmo(WeaponClass, Clips);
 }
@@ -2,12 +2,12 @@
 
 #include "Pickups/MSHealthPickup.h"
 #include "Components/MSHealthComponent.h"
-#include "Core/CoreUtils.h"
+#include "Core/MSComponentRegistry.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogHealthPickup, All, All);
 
 bool AMSHealthPickup::GivePickupTo(APawn* Pawn)
 {
-    auto HealthComponent = FCoreUtils::GetActorComponent<UMSHealthComponent>(Pawn);
+    auto HealthComponent = FMSComponentRegistry::GetComponent<UMSHealthComponent>(Pawn);
     return HealthComponent && HealthComponent->TryToAddHealth(Health);
 }
@@ -1,13 +1,14 @@
 // MyShooter Game, All Rights Reserved.
 
 #include "Pickups/MSPickup.h"
+#include "Pickups/MSPickupSubsystem.h"
 #include "Components/SphereComponent.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogPickup, All, All);
 
 AMSPickup::AMSPickup()
 {
-    PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bCanEverTick = false;
 
     CollisionComponent = CreateDefaultSubobject<USphereComponent>("CollisionComponent");
     CollisionComponent->InitSphereRadius(50.0f);
@@ -23,6 +24,21 @@ void AMSPickup::BeginPlay()
     check(CollisionComponent);
 
     GenerateRotation();
+
+    if (UMSPickupSubsystem* PickupSubsystem = GetWorld()->GetSubsystem<UMSPickupSubsystem>())
+    {
+        PickupSubsystem->AddPickup(this);
+    }
+}
+
+void AMSPickup::EndPlay(EEndPlayReason::Type Reason)
+{
+    if (UMSPickupSubsystem* PickupSubsystem = GetWorld()->GetSubsystem<UMSPickupSubsystem>())
+    {
+        PickupSubsystem->RemovePickup(this);
+    }
+
+    Super::EndPlay(Reason);
 }
 
 void AMSPickup::NotifyActorBeginOverlap(AActor* OtherActor)
@@ -51,23 +67,32 @@ void AMSPickup::Hide()
     CollisionComponent->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
     GetRootComponent()->SetVisibility(false, true);
 
-    GetWorldTimerManager().SetTimer(RespawnTimer, this, &AMSPickup::Respawn, RespawnTime, false);
+    bTaken = true;
+
+    if (UMSPickupSubsystem* PickupSubsystem = GetWorld()->GetSubsystem<UMSPickupSubsystem>())
+    {
+        PickupSubsystem->ScheduleRespawn(this, RespawnTime);
+    }
 }
 
 void AMSPickup::Respawn()
 {
+    bTaken = false;
+
     CollisionComponent->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Overlap);
     GetRootComponent()->SetVisibility(true, true);
 
     GenerateRotation();
-}
-
-void AMSPickup::Tick(float DeltaTime)
-{
-    Super::Tick(DeltaTime);
 
     // Handle case when actor may stay on the pickup before it's respawned
     ClearComponentOverlaps();
+    UpdateOverlaps();
+}
 
-    AddActorLocalRotation(FRotator(0.0f, RotationYaw * DeltaTime, 0.0f));
+void AMSPickup::UpdateRotation(float DeltaTime)
+{
+    // Collision is a sphere, so only render transforms need to be updated, not physics and overlaps
+    const FRotator Rotation = CollisionComponent->GetRelativeRotation() + FRotator(0.0f, RotationYaw * DeltaTime, 0.0f);
+    CollisionComponent->SetRelativeRotation_Direct(Rotation.GetNormalized());
+    CollisionComponent->UpdateComponentToWorld(EUpdateTransformFlags::SkipPhysicsUpdate);
 }
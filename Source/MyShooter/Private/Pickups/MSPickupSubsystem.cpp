@@ -0,0 +1,170 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "Pickups/MSPickupSubsystem.h"
+#include "Pickups/MSPickup.h"
+#include "Misc/App.h"
+
+void UMSPickupSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    WheelSlotTime = FMath::Max(WheelSlotTime, KINDA_SMALL_NUMBER);
+    Wheel.SetNum(FMath::Max(NumWheelSlots, 1));
+}
+
+void UMSPickupSubsystem::AddPickup(AMSPickup* Pickup)
+{
+    if (!Pickup || PickupLocations.Contains(Pickup))
+    {
+        return;
+    }
+
+    const UClass* PickupClass = Pickup->GetClass();
+    int32 TypeIndex = PickupTypes.IndexOfByPredicate([&](const FPickupType& PickupType) { return PickupType.Class == PickupClass; });
+    if (TypeIndex == INDEX_NONE)
+    {
+        TypeIndex = PickupTypes.AddDefaulted();
+        PickupTypes[TypeIndex].Class = PickupClass;
+    }
+
+    FPickupType& PickupType = PickupTypes[TypeIndex];
+    const int32 Index = PickupType.Pickups.Add(Pickup);
+    PickupType.Available.Add(Pickup->CanBeTaken());
+
+    PickupLocations.Add(Pickup, { TypeIndex, Index });
+}
+
+void UMSPickupSubsystem::RemovePickup(AMSPickup* Pickup)
+{
+    // Scheduled respawn of removed pickup is dropped by weak pointer
+    FPickupLocation Location;
+    if (!PickupLocations.RemoveAndCopyValue(Pickup, Location))
+    {
+        return;
+    }
+
+    FPickupType& PickupType = PickupTypes[Location.TypeIndex];
+    PickupType.Pickups.RemoveAtSwap(Location.Index, 1, false);
+    PickupType.Available.RemoveAtSwap(Location.Index);
+
+    // Fix location of pickup moved to removed slot
+    if (PickupType.Pickups.IsValidIndex(Location.Index))
+    {
+        if (FPickupLocation* MovedLocation = PickupLocations.Find(PickupType.Pickups[Location.Index].Get()))
+        {
+            MovedLocation->Index = Location.Index;
+        }
+    }
+}
+
+void UMSPickupSubsystem::ScheduleRespawn(AMSPickup* Pickup, float Delay)
+{
+    if (!Pickup)
+    {
+        return;
+    }
+
+    // Count time already passed in current slot, so pickup isn't respawned earlier than delay
+    const int32 NumSlots = Wheel.Num();
+    const int32 NumSteps = FMath::Max(1, FMath::CeilToInt((Delay + WheelAccumulator) / WheelSlotTime));
+    const int32 SlotIndex = (WheelCursor + NumSteps) % NumSlots;
+
+    Wheel[SlotIndex].Add({ Pickup, (NumSteps - 1) / NumSlots });
+    ++NumScheduled;
+
+    SetAvailable(Pickup, false);
+}
+
+void UMSPickupSubsystem::Deinitialize()
+{
+    PickupTypes.Empty();
+    PickupLocations.Empty();
+    Wheel.Empty();
+    NumScheduled = 0;
+
+    Super::Deinitialize();
+}
+
+void UMSPickupSubsystem::Tick(float DeltaTime)
+{
+    AdvanceWheel(DeltaTime);
+    RotatePickups(DeltaTime);
+}
+
+bool UMSPickupSubsystem::IsTickable() const
+{
+    return !HasAnyFlags(RF_ClassDefaultObject) && (PickupLocations.Num() > 0 || NumScheduled > 0);
+}
+
+TStatId UMSPickupSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMSPickupSubsystem, STATGROUP_Tickables);
+}
+
+void UMSPickupSubsystem::AdvanceWheel(float DeltaTime)
+{
+    WheelAccumulator += DeltaTime;
+
+    while (WheelAccumulator >= WheelSlotTime)
+    {
+        WheelAccumulator -= WheelSlotTime;
+        WheelCursor = (WheelCursor + 1) % Wheel.Num();
+
+        if (NumScheduled > 0)
+        {
+            RespawnSlot(WheelCursor);
+        }
+    }
+}
+
+void UMSPickupSubsystem::RespawnSlot(int32 SlotIndex)
+{
+    TArray<FRespawnEntry>& Slot = Wheel[SlotIndex];
+
+    for (int32 i = Slot.Num() - 1; i >= 0; --i)
+    {
+        FRespawnEntry& Entry = Slot[i];
+
+        // Delay is longer than one wheel turn
+        if (Entry.Rounds > 0 && Entry.Pickup.IsValid())
+        {
+            --Entry.Rounds;
+            continue;
+        }
+
+        AMSPickup* Pickup = Entry.Pickup.Get();
+
+        Slot.RemoveAtSwap(i, 1, false);
+        --NumScheduled;
+
+        if (Pickup)
+        {
+            SetAvailable(Pickup, true);
+            Pickup->Respawn();
+        }
+    }
+}
+
+void UMSPickupSubsystem::RotatePickups(float DeltaTime)
+{
+    // Rotation is only visual
+    if (!FApp::CanEverRender())
+    {
+        return;
+    }
+
+    ForEachAvailablePickup(nullptr, [DeltaTime](AMSPickup* Pickup) {
+        if (Pickup->WasRecentlyRendered())
+        {
+            Pickup->UpdateRotation(DeltaTime);
+        }
+    });
+}
+
+void UMSPickupSubsystem::SetAvailable(const AMSPickup* Pickup, bool bAvailable)
+{
+    if (const FPickupLocation* Location = PickupLocations.Find(Pickup))
+    {
+        PickupTypes[Location->TypeIndex].Available[Location->Index] = bAvailable;
+    }
+}
@@ -10,13 +10,15 @@
 #include "GameFramework/SpringArmComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/Controller.h"
+#include "AI/MSCombatantGridSubsystem.h"
+#include "Core/MSSignificanceSubsystem.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogCharacter, All, All);
 
 AMSCharacter::AMSCharacter(const FObjectInitializer& ObjInit) :
     Super(ObjInit.SetDefaultSubobjectClass<UMSCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
-    PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bCanEverTick = false;
 
     SpringArmComponent = CreateDefaultSubobject<USpringArmComponent>("SpringArmComponent");
     SpringArmComponent->SetupAttachment(GetRootComponent());
@@ -51,11 +53,31 @@ void AMSCharacter::BeginPlay()
     OnHealthChanged(HealthComponent->GetHealth(), 0.0f);
 
     LandedDelegate.AddDynamic(this, &AMSCharacter::OnGroundLanded);
+
+    if (UMSCombatantGridSubsystem* CombatantGrid = GetWorld()->GetSubsystem<UMSCombatantGridSubsystem>())
+    {
+        CombatantGrid->AddCombatant(this);
+    }
+
+    if (UMSSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UMSSignificanceSubsystem>())
+    {
+        Significance->AddCharacter(this);
+    }
 }
 
-void AMSCharacter::Tick(float DeltaTime)
+void AMSCharacter::EndPlay(EEndPlayReason::Type Reason)
 {
-    Super::Tick(DeltaTime);
+    if (UMSCombatantGridSubsystem* CombatantGrid = GetWorld()->GetSubsystem<UMSCombatantGridSubsystem>())
+    {
+        CombatantGrid->RemoveCombatant(this);
+    }
+
+    if (UMSSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UMSSignificanceSubsystem>())
+    {
+        Significance->RemoveCharacter(this);
+    }
+
+    Super::EndPlay(Reason);
 }
 
 void AMSCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -97,25 +119,53 @@ float AMSCharacter::GetMovementDirection() const
     return CrossProduct.IsZero() ? AngleBetween : AngleBetween * FMath::Sign(CrossProduct.Z);
 }
 
-void AMSCharacter::SetCharacterColor(const FLinearColor& Color)
+void AMSCharacter::SetCharacterMaterial(UMaterialInterface* Material)
 {
-    UMaterialInstanceDynamic* MaterialInstance = GetMesh()->CreateAndSetMaterialInstanceDynamic(0);
-    if (MaterialInstance)
+    if (Material && GetMesh()->GetMaterial(0) != Material)
     {
-        MaterialInstance->SetVectorParameterValue(MaterialColorName, Color);
+        GetMesh()->SetMaterial(0, Material);
     }
 }
 
+UMaterialInterface* AMSCharacter::GetBaseMaterial() const
+{
+    // Mesh could already use team material
+    UMaterialInterface* Material = GetMesh()->GetMaterial(0);
+    const UMaterialInstanceDynamic* MaterialInstance = Cast<UMaterialInstanceDynamic>(Material);
+
+    return MaterialInstance ? MaterialInstance->Parent : Material;
+}
+
 void AMSCharacter::MoveForward(float Amount)
 {
     bMovingForward = Amount > 0.0f;
     AddMovementInput(GetActorForwardVector(), Amount);
 }
 
+bool AMSCharacter::ResetForRound()
+{
+    if (HealthComponent->IsDead())
+    {
+        return false;
+    }
+
+    GetCharacterMovement()->StopMovementImmediately();
+
+    HealthComponent->ResetHealth();
+    WeaponComponent->ResetWeapons();
+
+    return true;
+}
+
 void AMSCharacter::OnDeath()
 {
     UE_LOG(LogCharacter, Display, TEXT("Player %s is dead"), *GetName());
 
+    if (UMSCombatantGridSubsystem* CombatantGrid = GetWorld()->GetSubsystem<UMSCombatantGridSubsystem>())
+    {
+        CombatantGrid->RemoveCombatant(this);
+    }
+
     GetCharacterMovement()->DisableMovement();
     GetCapsuleComponent()->SetCollisionResponseToAllChannels(ECR_Ignore);
 
@@ -149,4 +199,4 @@ void AMSCharacter::OnGroundLanded(const FHitResult& HitResult)
     TakeDamage(Damage, FDamageEvent(), nullptr, nullptr);
 
     UE_LOG(LogCharacter, Display, TEXT("Damage by landing: %f"), Damage);
-}
\ No newline at end of file
+}
@@ -1,5 +1,56 @@
 // MyShooter Game, All Rights Reserved.
 
-
 #include "Player/MSPlayerController.h"
+#include "Dev/MSReplaySubsystem.h"
+
+void AMSPlayerController::SetPawn(APawn* InPawn)
+{
+    Super::SetPawn(InPawn);
+
+    OnPawnChanged.Broadcast(InPawn);
+}
+
+void AMSPlayerController::ChangeState(FName NewState)
+{
+    const FName OldState = GetStateName();
+
+    Super::ChangeState(NewState);
+
+    if (OldState != NewState)
+    {
+        OnStateChanged.Broadcast(NewState);
+    }
+}
+
+bool AMSPlayerController::InputKey(FKey Key, EInputEvent EventType, float AmountDepressed, bool bGamepad)
+{
+    UMSReplaySubsystem* Replay = GetWorld()->GetSubsystem<UMSReplaySubsystem>();
+    if (Replay && Replay->IsReplaying() && !Replay->IsInjectingInput())
+    {
+        // Only recorded input is played during replay
+        return true;
+    }
+
+    if (Replay && Replay->IsRecording())
+    {
+        Replay->RecordKey(Key, EventType, AmountDepressed, bGamepad);
+    }
+
+    return Super::InputKey(Key, EventType, AmountDepressed, bGamepad);
+}
+
+bool AMSPlayerController::InputAxis(FKey Key, float Delta, float DeltaTime, int32 NumSamples, bool bGamepad)
+{
+    UMSReplaySubsystem* Replay = GetWorld()->GetSubsystem<UMSReplaySubsystem>();
+    if (Replay && Replay->IsReplaying() && !Replay->IsInjectingInput())
+    {
+        return true;
+    }
+
+    if (Replay && Replay->IsRecording())
+    {
+        Replay->RecordAxis(Key, Delta, NumSamples, bGamepad);
+    }
 
+    return Super::InputAxis(Key, Delta, DeltaTime, NumSamples, bGamepad);
+}
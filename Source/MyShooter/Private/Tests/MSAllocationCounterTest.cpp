@@ -0,0 +1,70 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "Dev/MSAllocationCounter.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && !UE_BUILD_SHIPPING
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMSHotPathAllocationsTest, "MyShooter.Performance.HotPathAllocations",
+    EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+// Plays test level with bots and expects no heap allocations per rifle shot, other hot scopes are only logged.
+// Warm up lets pools, queues and reused arrays grow to their steady state size first.
+// Runs in game client, e.g. -game -MSCountAllocations -ExecCmds="Automation RunTests MyShooter.Performance"
+bool FMSHotPathAllocationsTest::RunTest(const FString& Parameters)
+{
+    static constexpr float WarmUpTime = 5.0f;
+    static constexpr float CountingTime = 10.0f;
+
+    if (!FMSAllocationCounter::IsInstalled())
+    {
+        AddWarning(TEXT("Allocation counter isn't installed, run with -MSCountAllocations"));
+        return true;
+    }
+
+    AutomationOpenMap(TEXT("/Game/Levels/TestLevel"));
+    ADD_LATENT_AUTOMATION_COMMAND(FEngineWaitLatentCommand(WarmUpTime));
+
+    ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([]() {
+        FMSAllocationCounter::ResetStats();
+        FMSAllocationCounter::SetEnabled(true);
+        return true;
+    }));
+
+    ADD_LATENT_AUTOMATION_COMMAND(FEngineWaitLatentCommand(CountingTime));
+
+    ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this]() {
+        FMSAllocationCounter::SetEnabled(false);
+        FMSAllocationCounter::LogStats();
+
+        // Launcher shots may spawn projectiles when pool is empty, resolved shots and AI services call into engine,
+        // so only rifle shot, which touches reused storage only, is asserted
+        for (const TCHAR* ScopeName : { TEXT("LauncherShot"), TEXT("ResolveShot"), TEXT("AIUpdate"), TEXT("AISense") })
+        {
+            int32 NumCalls = 0;
+            int64 NumAllocations = 0;
+            if (FMSAllocationCounter::FindScopeStats(ScopeName, NumCalls, NumAllocations))
+            {
+                AddInfo(FString::Printf(TEXT("%s: %lld allocations in %d calls"), ScopeName, NumAllocations, NumCalls));
+            }
+        }
+
+        int32 NumShots = 0;
+        int64 NumShotAllocations = 0;
+        if (!FMSAllocationCounter::FindScopeStats(TEXT("RifleShot"), NumShots, NumShotAllocations))
+        {
+            AddError(TEXT("No rifle shots while counting"));
+            return true;
+        }
+
+        const FString What = FString::Printf(TEXT("RifleShot allocations in %d calls"), NumShots);
+        TestEqual(*What, NumShotAllocations, static_cast<int64>(0));
+
+        return true;
+    }));
+
+    return true;
+}
+
+#endif
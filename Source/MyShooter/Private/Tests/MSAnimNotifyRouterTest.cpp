@@ -0,0 +1,56 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "Animations/MSAnimNotifyRouter.h"
+#include "Animations/MSAnimNotify.h"
+#include "Animations/MSEquipFinishedAnimNotify.h"
+#include "Animations/MSReloadFinishedAnimNotify.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMSAnimNotifyRouterTest, "MyShooter.Animations.AnimNotifyRouter",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+// Notify of one character's montage should reach only listener of that character's mesh and notify class
+bool FMSAnimNotifyRouterTest::RunTest(const FString& Parameters)
+{
+    FMSAnimNotifyRouter Router;
+
+    USkeletalMeshComponent* MeshA = NewObject<USkeletalMeshComponent>(GetTransientPackage());
+    USkeletalMeshComponent* MeshB = NewObject<USkeletalMeshComponent>(GetTransientPackage());
+    const UMSAnimNotify* ReloadNotify = NewObject<UMSReloadFinishedAnimNotify>(GetTransientPackage());
+
+    int32 NumReloadsA = 0;
+    int32 NumReloadsB = 0;
+    int32 NumEquipsA = 0;
+    int32 NumNotifiesB = 0;
+
+    const auto CountCalls = [](int32& NumCalls) { //
+        return FMSAnimNotifyDelegate::CreateLambda([&NumCalls](USkeletalMeshComponent*) { ++NumCalls; });
+    };
+
+    Router.Register<UMSReloadFinishedAnimNotify>(MeshA, CountCalls(NumReloadsA));
+    Router.Register<UMSEquipFinishedAnimNotify>(MeshA, CountCalls(NumEquipsA));
+    Router.Register<UMSReloadFinishedAnimNotify>(MeshB, CountCalls(NumReloadsB));
+
+    Router.Dispatch(ReloadNotify, MeshA);
+
+    TestEqual(TEXT("Reload callbacks of notified mesh"), NumReloadsA, 1);
+    TestEqual(TEXT("Equip callbacks of notified mesh"), NumEquipsA, 0);
+    TestEqual(TEXT("Reload callbacks of other mesh"), NumReloadsB, 0);
+
+    // Listener of base notify class also gets notifies of its subclasses, e.g. blueprint ones
+    Router.Unregister<UMSReloadFinishedAnimNotify>(MeshB);
+    Router.Register<UMSAnimNotify>(MeshB, CountCalls(NumNotifiesB));
+
+    Router.Dispatch(ReloadNotify, MeshB);
+
+    TestEqual(TEXT("Base class callbacks of subclass notify"), NumNotifiesB, 1);
+    TestEqual(TEXT("Reload callbacks of unregistered listener"), NumReloadsB, 0);
+    TestEqual(TEXT("Reload callbacks of other mesh"), NumReloadsA, 1);
+
+    return true;
+}
+
+#endif
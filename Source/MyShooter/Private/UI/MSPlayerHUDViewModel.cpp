@@ -0,0 +1,155 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "UI/MSPlayerHUDViewModel.h"
+#include "Player/MSPlayerController.h"
+#include "Components/MSHealthComponent.h"
+#include "Components/MSWeaponComponent.h"
+#include "Core/MSComponentRegistry.h"
+
+void UMSPlayerHUDViewModel::Initialize(AMSPlayerController* InPlayerController)
+{
+    Deinitialize();
+
+    PlayerController = InPlayerController;
+    if (!PlayerController)
+    {
+        return;
+    }
+
+    PlayerController->OnPawnChanged.AddUObject(this, &UMSPlayerHUDViewModel::OnPawnChanged);
+    PlayerController->OnStateChanged.AddUObject(this, &UMSPlayerHUDViewModel::OnControllerStateChanged);
+
+    BindPawn(PlayerController->GetPawn());
+}
+
+void UMSPlayerHUDViewModel::Deinitialize()
+{
+    UnbindPawn();
+
+    if (PlayerController)
+    {
+        PlayerController->OnPawnChanged.RemoveAll(this);
+        PlayerController->OnStateChanged.RemoveAll(this);
+        PlayerController = nullptr;
+    }
+}
+
+void UMSPlayerHUDViewModel::BindPawn(APawn* InPawn)
+{
+    UnbindPawn();
+
+    Pawn = InPawn;
+    HealthComponent = FMSComponentRegistry::GetComponent<UMSHealthComponent>(InPawn);
+    WeaponComponent = FMSComponentRegistry::GetComponent<UMSWeaponComponent>(InPawn);
+
+    if (HealthComponent.IsValid())
+    {
+        HealthComponent->OnHealthChanged.AddUObject(this, &UMSPlayerHUDViewModel::OnPlayerHealthChanged);
+        HealthComponent->OnDeath.AddUObject(this, &UMSPlayerHUDViewModel::OnPlayerDeath);
+    }
+
+    if (WeaponComponent.IsValid())
+    {
+        WeaponComponent->OnWeaponChanged.AddUObject(this, &UMSPlayerHUDViewModel::OnPlayerWeaponChanged);
+        WeaponComponent->OnAmmoChanged.AddUObject(this, &UMSPlayerHUDViewModel::OnPlayerAmmoChanged);
+    }
+
+    UpdateHealth(0.0f);
+    UpdateWeapon();
+    UpdatePlayerState();
+}
+
+void UMSPlayerHUDViewModel::UnbindPawn()
+{
+    if (HealthComponent.IsValid())
+    {
+        HealthComponent->OnHealthChanged.RemoveAll(this);
+        HealthComponent->OnDeath.RemoveAll(this);
+    }
+
+    if (WeaponComponent.IsValid())
+    {
+        WeaponComponent->OnWeaponChanged.RemoveAll(this);
+        WeaponComponent->OnAmmoChanged.RemoveAll(this);
+    }
+
+    Pawn.Reset();
+    HealthComponent.Reset();
+    WeaponComponent.Reset();
+}
+
+void UMSPlayerHUDViewModel::OnPawnChanged(APawn* InPawn)
+{
+    if (Pawn.Get() != InPawn)
+    {
+        BindPawn(InPawn);
+    }
+}
+
+void UMSPlayerHUDViewModel::OnControllerStateChanged(FName StateName)
+{
+    UpdatePlayerState();
+}
+
+void UMSPlayerHUDViewModel::OnPlayerHealthChanged(float Health, float DeltaHealth)
+{
+    UpdateHealth(DeltaHealth);
+}
+
+void UMSPlayerHUDViewModel::OnPlayerDeath()
+{
+    UpdatePlayerState();
+}
+
+void UMSPlayerHUDViewModel::OnPlayerWeaponChanged(AMSWeapon* Weapon)
+{
+    UpdateWeapon();
+}
+
+void UMSPlayerHUDViewModel::OnPlayerAmmoChanged(AMSWeapon* Weapon)
+{
+    UpdateAmmo();
+}
+
+void UMSPlayerHUDViewModel::UpdateHealth(float DeltaHealth)
+{
+    const float NewHealthPercent = HealthComponent.IsValid() ? HealthComponent->GetHealthPercent() : 0.0f;
+    if (FMath::IsNearlyEqual(HealthPercent, NewHealthPercent) && FMath::IsNearlyZero(DeltaHealth))
+    {
+        return;
+    }
+
+    HealthPercent = NewHealthPercent;
+    OnHealthChanged.Broadcast(HealthPercent, DeltaHealth);
+}
+
+void UMSPlayerHUDViewModel::UpdateWeapon()
+{
+    bHasWeapon = WeaponComponent.IsValid() && WeaponComponent->GetWeaponUIData(WeaponUIData);
+    OnWeaponChanged.Broadcast();
+
+    // Ammo of new weapon should be shown too
+    UpdateAmmo();
+}
+
+void UMSPlayerHUDViewModel::UpdateAmmo()
+{
+    if (WeaponComponent.IsValid() && WeaponComponent->GetWeaponAmmoData(CurrentAmmo, DefaultAmmo))
+    {
+        OnAmmoChanged.Broadcast();
+    }
+}
+
+void UMSPlayerHUDViewModel::UpdatePlayerState()
+{
+    const bool bNewPlayerAlive = HealthComponent.IsValid() && !HealthComponent->IsDead();
+    const bool bNewPlayerSpectating = PlayerController && PlayerController->GetStateName() == NAME_Spectating;
+    if (bNewPlayerAlive == bPlayerAlive && bNewPlayerSpectating == bPlayerSpectating)
+    {
+        return;
+    }
+
+    bPlayerAlive = bNewPlayerAlive;
+    bPlayerSpectating = bNewPlayerSpectating;
+    OnPlayerStateChanged.Broadcast();
+}
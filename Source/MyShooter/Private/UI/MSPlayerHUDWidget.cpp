@@ -1,54 +1,104 @@
 // MyShooter Game, All Rights Reserved.
 
 #include "UI/MSPlayerHUDWidget.h"
-#include "Components/MSHealthComponent.h"
-#include "Components/MSWeaponComponent.h"
+#include "UI/MSPlayerHUDViewModel.h"
+#include "Player/MSPlayerController.h"
+#include "Components/InvalidationBox.h"
 
 float UMSPlayerHUDWidget::GetHealthPercent() const
 {
-    const auto HealthComponent = GetPlayerComponent<UMSHealthComponent>();
-    return HealthComponent ? HealthComponent->GetHealthPercent() : 0.0f;
+    return ViewModel ? ViewModel->GetHealthPercent() : 0.0f;
 }
 
 bool UMSPlayerHUDWidget::GetWeaponUIData(FWeaponUIData& UIData) const
 {
-    const auto WeaponComponent = GetPlayerComponent<UMSWeaponComponent>();
-    return WeaponComponent && WeaponComponent->GetWeaponUIData(UIData);
+    if (!ViewModel || !ViewModel->HasWeapon())
+    {
+        return false;
+    }
+
+    UIData = ViewModel->GetWeaponUIData();
+    return true;
 }
 
 bool UMSPlayerHUDWidget::GetWeaponAmmoData(FAmmoData& CurrentAmmo, FAmmoData& DefaultAmmo) const
 {
-    const auto WeaponComponent = GetPlayerComponent<UMSWeaponComponent>();
-    return WeaponComponent && WeaponComponent->GetWeaponAmmoData(CurrentAmmo, DefaultAmmo);
+    if (!ViewModel || !ViewModel->HasWeapon())
+    {
+        return false;
+    }
+
+    CurrentAmmo = ViewModel->GetCurrentAmmo();
+    DefaultAmmo = ViewModel->GetDefaultAmmo();
+    return true;
 }
 
 bool UMSPlayerHUDWidget::IsPlayerAlive() const
 {
-    auto HealthComponent = GetPlayerComponent<UMSHealthComponent>();
-    return HealthComponent && !HealthComponent->IsDead();
+    return ViewModel && ViewModel->IsPlayerAlive();
 }
 
 bool UMSPlayerHUDWidget::IsPlayerSpectating() const
 {
-    const auto Controller = GetOwningPlayer();
-    return Controller && Controller->GetStateName() == NAME_Spectating;
+    return ViewModel && ViewModel->IsPlayerSpectating();
+}
+
+void UMSPlayerHUDWidget::NativeConstruct()
+{
+    // View model should be ready before blueprint construct
+    ViewModel = NewObject<UMSPlayerHUDViewModel>(this);
+    ViewModel->Initialize(GetOwningPlayer<AMSPlayerController>());
+    ViewModel->OnHealthChanged.AddUObject(this, &UMSPlayerHUDWidget::OnHealthChanged);
+    ViewModel->OnWeaponChanged.AddUObject(this, &UMSPlayerHUDWidget::OnWeaponChanged);
+    ViewModel->OnAmmoChanged.AddUObject(this, &UMSPlayerHUDWidget::OnAmmoChanged);
+    ViewModel->OnPlayerStateChanged.AddUObject(this, &UMSPlayerHUDWidget::OnPlayerStateChanged);
+
+    if (HUDInvalidationBox)
+    {
+        HUDInvalidationBox->SetCanCache(true);
+    }
+
+    Super::NativeConstruct();
+
+    // Push initial state, later updates come only on change
+    OnHealthUpdated(ViewModel->GetHealthPercent());
+    OnWeaponChanged();
+    OnAmmoChanged();
+    OnPlayerStateChanged();
 }
 
-bool UMSPlayerHUDWidget::Initialize()
+void UMSPlayerHUDWidget::NativeDestruct()
 {
-    auto HealthComponent = GetPlayerComponent<UMSHealthComponent>();
-    if (HealthComponent)
+    if (ViewModel)
     {
-        HealthComponent->OnHealthChanged.AddUObject(this, &UMSPlayerHUDWidget::OnHealthChanged);
+        ViewModel->Deinitialize();
+        ViewModel = nullptr;
     }
 
-    return Super::Initialize();
+    Super::NativeDestruct();
 }
 
-void UMSPlayerHUDWidget::OnHealthChanged(float Health, float DeltaHealth)
+void UMSPlayerHUDWidget::OnHealthChanged(float HealthPercent, float DeltaHealth)
 {
     if (DeltaHealth < 0)
     {
         OnDamageTaken();
     }
+
+    OnHealthUpdated(HealthPercent);
+}
+
+void UMSPlayerHUDWidget::OnWeaponChanged()
+{
+    OnWeaponUpdated(ViewModel->HasWeapon(), ViewModel->GetWeaponUIData());
+}
+
+void UMSPlayerHUDWidget::OnAmmoChanged()
+{
+    OnAmmoUpdated(ViewModel->GetCurrentAmmo(), ViewModel->GetDefaultAmmo());
+}
+
+void UMSPlayerHUDWidget::OnPlayerStateChanged()
+{
+    OnPlayerStateUpdated(ViewModel->IsPlayerAlive(), ViewModel->IsPlayerSpectating());
 }
@@ -1,10 +1,8 @@
 // MyShooter Game, All Rights Reserved.
 
 #include "Components/MSWeaponFXComponent.h"
-#include "Components/DecalComponent.h"
-#include "Kismet/GameplayStatics.h"
-#include "GameFramework/Character.h"
-#include "NiagaraFunctionLibrary.h"
+#include "Weapon/MSImpactFXSubsystem.h"
+#include "Core/MSStats.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
 
 UMSWeaponFXComponent::UMSWeaponFXComponent()
@@ -14,6 +12,9 @@ UMSWeaponFXComponent::UMSWeaponFXComponent()
 
 void UMSWeaponFXComponent::PlayImpactFX(const FHitResult& HitResult) const
 {
+    MS_SCOPE_CYCLE_COUNTER(PlayImpactFX);
+    MS_INC_FRAME_COUNTER(Impacts);
+
     // Find impact data
     const FImpactData* ImpactData = &DefaultImpactData;
 
@@ -26,30 +27,10 @@ void UMSWeaponFXComponent::PlayImpactFX(const FHitResult& HitResult) const
         }
     }
 
-    // Spawn niagara effect
-    UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-        GetWorld(),                       //
-        ImpactData->NiagaraEffect,        //
-        HitResult.ImpactPoint,            //
-        HitResult.ImpactNormal.Rotation() //
-    );
-
-    // Spawn decal
-    UDecalComponent* DecalComponent = UGameplayStatics::SpawnDecalAtLocation(
-        GetWorld(),                       //
-        ImpactData->DecalData.Material,   //
-        ImpactData->DecalData.Size,       //
-        HitResult.ImpactPoint,            //
-        HitResult.ImpactNormal.Rotation() //
-    );
-
-    if (DecalComponent)
+    // Niagara effect and decal are spawned by impact FX subsystem within its budget
+    const UWorld* World = GetWorld();
+    if (UMSImpactFXSubsystem* ImpactFXSubsystem = World ? World->GetSubsystem<UMSImpactFXSubsystem>() : nullptr)
     {
-        DecalComponent->SetFadeOut(ImpactData->DecalData.LifeTime, ImpactData->DecalData.FadeOutTime);
-
-        if (ACharacter* Character = Cast<ACharacter>(HitResult.Actor.Get()))
-        {
-            DecalComponent->AttachToComponent(Character->GetMesh(), FAttachmentTransformRules::KeepWorldTransform, HitResult.BoneName);
-        }
+        ImpactFXSubsystem->QueueImpact(*ImpactData, HitResult);
     }
 }
@@ -0,0 +1,116 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "Weapon/MSFireSchedulerSubsystem.h"
+#include "Weapon/MSRifleWeapon.h"
+#include "Core/MSStats.h"
+#include "Engine/World.h"
+
+void UMSFireSchedulerSubsystem::StartFiring(AMSRifleWeapon* Weapon, float TimeBetweenShots)
+{
+    if (!Weapon || IsFiring(Weapon))
+    {
+        return;
+    }
+
+    FFiringWeapon& FiringWeapon = FiringWeapons.AddDefaulted_GetRef();
+    FiringWeapon.Weapon = Weapon;
+    FiringWeapon.TimeBetweenShots = FMath::Max(TimeBetweenShots, KINDA_SMALL_NUMBER);
+}
+
+void UMSFireSchedulerSubsystem::StopFiring(AMSRifleWeapon* Weapon)
+{
+    // Entries are removed after batched pass, so due shot indices stay valid while shots are fired
+    const int32 FiringIndex = FindFiringIndex(Weapon);
+    if (FiringIndex != INDEX_NONE)
+    {
+        FiringWeapons[FiringIndex].Weapon.Reset();
+    }
+}
+
+void UMSFireSchedulerSubsystem::Deinitialize()
+{
+    FiringWeapons.Empty();
+    DueShots.Empty();
+
+    Super::Deinitialize();
+}
+
+void UMSFireSchedulerSubsystem::Tick(float DeltaTime)
+{
+    MS_SCOPE_CYCLE_COUNTER(FireScheduler);
+
+    const float CurrentTime = GetWorld()->GetTimeSeconds();
+
+    for (int32 FiringIndex = 0; FiringIndex < FiringWeapons.Num(); ++FiringIndex)
+    {
+        FFiringWeapon& FiringWeapon = FiringWeapons[FiringIndex];
+        if (!FiringWeapon.Weapon.IsValid())
+        {
+            continue;
+        }
+
+        // Weapon has fired its first shot this frame
+        if (FiringWeapon.bJustStarted)
+        {
+            FiringWeapon.bJustStarted = false;
+            continue;
+        }
+
+        FiringWeapon.Accumulator += DeltaTime;
+
+        int32 NumShots = 0;
+        while (FiringWeapon.Accumulator >= FiringWeapon.TimeBetweenShots && NumShots < MaxShotsPerFrame)
+        {
+            FiringWeapon.Accumulator -= FiringWeapon.TimeBetweenShots;
+            DueShots.Add({ FiringIndex, CurrentTime - FiringWeapon.Accumulator });
+            ++NumShots;
+        }
+
+        if (NumShots == MaxShotsPerFrame)
+        {
+            FiringWeapon.Accumulator = FMath::Fmod(FiringWeapon.Accumulator, FiringWeapon.TimeBetweenShots);
+        }
+    }
+
+    // Fire shots of all weapons in time order
+    DueShots.Sort([](const FDueShot& A, const FDueShot& B) { //
+        return A.ShotTime < B.ShotTime;
+    });
+
+    for (const FDueShot& DueShot : DueShots)
+    {
+        // Weapon could stop firing on one of previous shots
+        if (AMSRifleWeapon* Weapon = FiringWeapons[DueShot.FiringIndex].Weapon.Get())
+        {
+            Weapon->MakeScheduledShot(DueShot.ShotTime);
+        }
+    }
+    DueShots.Reset();
+
+    FiringWeapons.RemoveAllSwap(
+        [](const FFiringWeapon& FiringWeapon) { return !FiringWeapon.Weapon.IsValid(); }, //
+        false                                                                             //
+    );
+}
+
+bool UMSFireSchedulerSubsystem::IsTickable() const
+{
+    return !HasAnyFlags(RF_ClassDefaultObject) && FiringWeapons.Num() > 0;
+}
+
+TStatId UMSFireSchedulerSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMSFireSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+int32 UMSFireSchedulerSubsystem::FindFiringIndex(const AMSRifleWeapon* Weapon) const
+{
+    if (!Weapon)
+    {
+        return INDEX_NONE;
+    }
+
+    return FiringWeapons.IndexOfByPredicate([Weapon](const FFiringWeapon& FiringWeapon) { //
+        return FiringWeapon.Weapon.Get() == Weapon;
+    });
+}
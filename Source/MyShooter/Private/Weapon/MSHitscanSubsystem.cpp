@@ -0,0 +1,131 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "Weapon/MSHitscanSubsystem.h"
+#include "Weapon/MSRifleWeapon.h"
+#include "Core/MSStats.h"
+#include "Dev/MSAllocationCounter.h"
+#include "Engine/World.h"
+
+void UMSHitscanSubsystem::QueueShot(AMSRifleWeapon* Weapon, const FShotContext& ShotContext)
+{
+    if (!Weapon)
+    {
+        return;
+    }
+
+    FShotRequest& Request = QueuedShots.AddDefaulted_GetRef();
+    Request.Weapon = Weapon;
+    Request.ShotContext = ShotContext;
+}
+
+void UMSHitscanSubsystem::Deinitialize()
+{
+    QueuedShots.Empty();
+    InFlightShots.Empty();
+    TraceDatum = FTraceDatum();
+
+    Super::Deinitialize();
+}
+
+void UMSHitscanSubsystem::Tick(float DeltaTime)
+{
+    // Traces sent on previous frame are ready now
+    ResolveShots();
+    DispatchShots();
+}
+
+bool UMSHitscanSubsystem::IsTickable() const
+{
+    return !HasAnyFlags(RF_ClassDefaultObject) && (QueuedShots.Num() > 0 || InFlightShots.Num() > 0);
+}
+
+TStatId UMSHitscanSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMSHitscanSubsystem, STATGROUP_Tickables);
+}
+
+void UMSHitscanSubsystem::ResolveShots()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        InFlightShots.Reset();
+        return;
+    }
+
+    for (const FShotRequest& Request : InFlightShots)
+    {
+        MS_SCOPE_ALLOCATION_COUNTER(ResolveShot);
+
+        AMSRifleWeapon* Weapon = Request.Weapon.Get();
+        if (!Weapon)
+        {
+            continue;
+        }
+
+        FHitResult HitResult(Request.ShotContext.TraceStart, Request.ShotContext.TraceEnd);
+        if (World->QueryTraceData(Request.TraceHandle, TraceDatum))
+        {
+            if (TraceDatum.OutHits.Num() > 0)
+            {
+                HitResult = TraceDatum.OutHits[0];
+            }
+        }
+        else
+        {
+            // Ammo is already spent, so shot with lost async result is traced again instead of disappearing
+            MS_INC_FRAME_COUNTER(Traces);
+            World->LineTraceSingleByChannel(
+                HitResult,                         //
+                Request.ShotContext.TraceStart,    //
+                Request.ShotContext.TraceEnd,      //
+                ECollisionChannel::ECC_Visibility, //
+                MakeCollisionParams(*Weapon)       //
+            );
+        }
+
+        Weapon->ResolveShot(Request.ShotContext, HitResult);
+    }
+
+    InFlightShots.Reset();
+}
+
+void UMSHitscanSubsystem::DispatchShots()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        QueuedShots.Reset();
+        return;
+    }
+
+    for (FShotRequest& Request : QueuedShots)
+    {
+        const AMSRifleWeapon* Weapon = Request.Weapon.Get();
+        if (!Weapon)
+        {
+            continue;
+        }
+
+        Request.TraceHandle = World->AsyncLineTraceByChannel(
+            EAsyncTraceType::Single,           //
+            Request.ShotContext.TraceStart,    //
+            Request.ShotContext.TraceEnd,      //
+            ECollisionChannel::ECC_Visibility, //
+            MakeCollisionParams(*Weapon)       //
+        );
+
+        InFlightShots.Add(Request);
+    }
+
+    MS_INC_FRAME_COUNTER_BY(Traces, InFlightShots.Num());
+
+    QueuedShots.Reset();
+}
+
+FCollisionQueryParams UMSHitscanSubsystem::MakeCollisionParams(const AMSRifleWeapon& Weapon)
+{
+    FCollisionQueryParams CollisionParams(SCENE_QUERY_STAT(MSHitscan), false, Weapon.GetOwner());
+    CollisionParams.bReturnPhysicalMaterial = true;
+    return CollisionParams;
+}
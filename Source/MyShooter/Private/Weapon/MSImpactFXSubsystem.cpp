@@ -0,0 +1,233 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "Weapon/MSImpactFXSubsystem.h"
+#include "Core/MSStats.h"
+#include "Components/DecalComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/WorldSettings.h"
+#include "Engine/World.h"
+#include "NiagaraFunctionLibrary.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogImpactFX, All, All);
+
+void UMSImpactFXSubsystem::QueueImpact(const FImpactData& ImpactData, const FHitResult& HitResult)
+{
+    // Nothing to see without rendering
+    if (!FApp::CanEverRender())
+    {
+        return;
+    }
+
+    ++Stats.NumRequested;
+
+    if (ViewLocationFrame != GFrameCounter)
+    {
+        UpdateViewLocation();
+    }
+
+    const float DistanceSquared = bHasViewLocation ? FVector::DistSquared(ViewLocation, HitResult.ImpactPoint) : 0.0f;
+    if (DistanceSquared > FMath::Square(MaxImpactDistance))
+    {
+        ++Stats.NumDroppedByDistance;
+        return;
+    }
+
+    FImpactRequest& Request = PendingImpacts.AddDefaulted_GetRef();
+    Request.NiagaraEffect = ImpactData.NiagaraEffect;
+    Request.DecalData = ImpactData.DecalData;
+    Request.Location = HitResult.ImpactPoint;
+    Request.Rotation = HitResult.ImpactNormal.Rotation();
+    Request.DistanceSquared = DistanceSquared;
+
+    // Hits on characters are more noticeable than hits on level geometry
+    ACharacter* Character = Cast<ACharacter>(HitResult.Actor.Get());
+    Request.bHighPriority = Character != nullptr;
+    if (Character)
+    {
+        Request.AttachComponent = Character->GetMesh();
+        Request.BoneName = HitResult.BoneName;
+    }
+}
+
+void UMSImpactFXSubsystem::LogStats() const
+{
+    UE_LOG(
+        LogImpactFX, Display, TEXT("Live decals %d/%d, requested %d, spawned %d, dropped by budget %d, by distance %d"),           //
+        Stats.NumLiveDecals, MaxDecals, Stats.NumRequested, Stats.NumSpawned, Stats.NumDroppedByBudget, Stats.NumDroppedByDistance //
+    );
+}
+
+void UMSImpactFXSubsystem::Deinitialize()
+{
+    Decals.Empty();
+    DecalExpireTimes.Empty();
+    PendingImpacts.Empty();
+
+    Super::Deinitialize();
+}
+
+void UMSImpactFXSubsystem::Tick(float DeltaTime)
+{
+    ExpireDecals();
+
+    if (PendingImpacts.Num() > MaxImpactsPerFrame)
+    {
+        // Keep the most important impacts within budget
+        PendingImpacts.Sort([](const FImpactRequest& A, const FImpactRequest& B) { //
+            return A.bHighPriority != B.bHighPriority ? A.bHighPriority : A.DistanceSquared < B.DistanceSquared;
+        });
+
+        Stats.NumDroppedByBudget += PendingImpacts.Num() - MaxImpactsPerFrame;
+        PendingImpacts.SetNum(MaxImpactsPerFrame, false);
+    }
+
+    for (const FImpactRequest& Request : PendingImpacts)
+    {
+        SpawnImpact(Request);
+    }
+    PendingImpacts.Reset();
+}
+
+bool UMSImpactFXSubsystem::IsTickable() const
+{
+    return !HasAnyFlags(RF_ClassDefaultObject) && (PendingImpacts.Num() > 0 || Stats.NumLiveDecals > 0);
+}
+
+TStatId UMSImpactFXSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMSImpactFXSubsystem, STATGROUP_Tickables);
+}
+
+void UMSImpactFXSubsystem::UpdateViewLocation()
+{
+    const UWorld* World = GetWorld();
+    const APlayerController* Controller = World ? World->GetFirstPlayerController() : nullptr;
+
+    ViewLocationFrame = GFrameCounter;
+    bHasViewLocation = Controller != nullptr;
+    if (bHasViewLocation)
+    {
+        FRotator ViewRotation;
+        Controller->GetPlayerViewPoint(ViewLocation, ViewRotation);
+    }
+}
+
+void UMSImpactFXSubsystem::ExpireDecals()
+{
+    const float Time = GetWorld()->GetTimeSeconds();
+
+    for (int32 i = 0; i < Decals.Num(); ++i)
+    {
+        UDecalComponent* Decal = Decals[i];
+        if (Decal && Decal->IsVisible() && DecalExpireTimes[i] <= Time)
+        {
+            Decal->SetVisibility(false);
+            Decal->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+            --Stats.NumLiveDecals;
+        }
+    }
+}
+
+void UMSImpactFXSubsystem::SpawnImpact(const FImpactRequest& Request)
+{
+    UWorld* World = GetWorld();
+
+    UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+        World,                     //
+        Request.NiagaraEffect,     //
+        Request.Location,          //
+        Request.Rotation,          //
+        FVector(1.0f),             //
+        true,                      //
+        true,                      //
+        ENCPoolMethod::AutoRelease //
+    );
+
+    MS_INC_FRAME_COUNTER(SpawnedFX);
+
+    int32 DecalIndex = INDEX_NONE;
+    UDecalComponent* Decal = GetNextDecal(DecalIndex);
+    if (!Decal)
+    {
+        return;
+    }
+
+    Decal->SetDecalMaterial(Request.DecalData.Material);
+    Decal->DecalSize = Request.DecalData.Size;
+    Decal->SetWorldLocationAndRotation(Request.Location, Request.Rotation);
+
+    // Decal stays in ring buffer after fade instead of being destroyed
+    Decal->SetFadeOut(Request.DecalData.LifeTime, Request.DecalData.FadeOutTime, false);
+    Decal->SetLifeSpan(0.0f);
+    Decal->SetVisibility(true);
+
+    if (USceneComponent* AttachComponent = Request.AttachComponent.Get())
+    {
+        Decal->AttachToComponent(AttachComponent, FAttachmentTransformRules::KeepWorldTransform, Request.BoneName);
+    }
+
+    DecalExpireTimes[DecalIndex] = World->GetTimeSeconds() + Request.DecalData.LifeTime + Request.DecalData.FadeOutTime;
+
+    ++Stats.NumLiveDecals;
+    ++Stats.NumSpawned;
+}
+
+UDecalComponent* UMSImpactFXSubsystem::GetNextDecal(int32& DecalIndex)
+{
+    UWorld* World = GetWorld();
+    if (!World || MaxDecals <= 0)
+    {
+        return nullptr;
+    }
+
+    DecalIndex = NextDecalIndex;
+    NextDecalIndex = (NextDecalIndex + 1) % MaxDecals;
+
+    if (Decals.IsValidIndex(DecalIndex) && IsValid(Decals[DecalIndex]))
+    {
+        UDecalComponent* Decal = Decals[DecalIndex];
+        if (Decal->IsVisible())
+        {
+            // Oldest decal is overwritten
+            Decal->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+            --Stats.NumLiveDecals;
+        }
+        return Decal;
+    }
+
+    UDecalComponent* Decal = NewObject<UDecalComponent>(World->GetWorldSettings());
+    Decal->bAllowAnyoneToDestroyMe = true;
+    Decal->SetUsingAbsoluteScale(true);
+    Decal->SetVisibility(false);
+    Decal->RegisterComponentWithWorld(World);
+
+    if (Decals.Num() <= DecalIndex)
+    {
+        Decals.SetNumZeroed(DecalIndex + 1);
+        DecalExpireTimes.SetNumZeroed(DecalIndex + 1);
+    }
+    Decals[DecalIndex] = Decal;
+
+    return Decal;
+}
+
+#if !UE_BUILD_SHIPPING
+
+static void LogImpactFXStats(UWorld* World)
+{
+    if (const auto ImpactFXSubsystem = World ? World->GetSubsystem<UMSImpactFXSubsystem>() : nullptr)
+    {
+        ImpactFXSubsystem->LogStats();
+    }
+}
+
+static FAutoConsoleCommandWithWorld LogImpactFXStatsCommand(
+    TEXT("MyShooter.ImpactFXStats"),                                  //
+    TEXT("Log impact FX and decal counters"),                         //
+    FConsoleCommandWithWorldDelegate::CreateStatic(&LogImpactFXStats) //
+);
+
+#endif
@@ -2,8 +2,21 @@
 
 #include "Weapon/MSLauncherWeapon.h"
 #include "Weapon/MSProjectile.h"
+#include "Core/MSActorPoolSubsystem.h"
+#include "Core/MSStats.h"
+#include "Dev/MSAllocationCounter.h"
 #include "DrawDebugHelpers.h"
 
+void AMSLauncherWeapon::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (UMSActorPoolSubsystem* ActorPool = GetWorld()->GetSubsystem<UMSActorPoolSubsystem>())
+    {
+        ActorPool->Prewarm(ProjectileClass, ProjectilePoolSize);
+    }
+}
+
 void AMSLauncherWeapon::StartFire()
 {
     MakeShot();
@@ -11,32 +24,35 @@ void AMSLauncherWeapon::StartFire()
 
 void AMSLauncherWeapon::MakeShot()
 {
+    MS_SCOPE_CYCLE_COUNTER(LauncherMakeShot);
+    MS_SCOPE_ALLOCATION_COUNTER(LauncherShot);
+
     if (IsAmmoEmpty())
     {
         return;
     }
 
     UWorld* World = GetWorld();
-    if (!World)
+    UMSActorPoolSubsystem* ActorPool = World ? World->GetSubsystem<UMSActorPoolSubsystem>() : nullptr;
+    if (!ActorPool)
     {
         return;
     }
 
-    FVector TraceStart;
-    FVector TraceEnd;
-    if (!GetTraceData(TraceStart, TraceEnd))
+    FShotContext ShotContext;
+    if (!MakeShotContext(ShotContext))
     {
         return;
     }
 
     FHitResult HitResult;
-    if (!MakeHit(HitResult, TraceStart, TraceEnd))
+    if (!MakeHit(HitResult, ShotContext.TraceStart, ShotContext.TraceEnd))
     {
         return;
     }
-    FVector EndPoint = HitResult.bBlockingHit ? HitResult.ImpactPoint : TraceEnd;
+    FVector EndPoint = HitResult.bBlockingHit ? HitResult.ImpactPoint : ShotContext.TraceEnd;
 
-    const FTransform SocketTransform = GetMuzzleTransform();
+    const FTransform& SocketTransform = ShotContext.MuzzleTransform;
     const FVector SocketDirection = SocketTransform.GetRotation().GetForwardVector();
     const FVector SocketToEnd = EndPoint - SocketTransform.GetLocation();
 
@@ -46,13 +62,12 @@ void AMSLauncherWeapon::MakeShot()
         return;
     }
 
-    const FTransform SpawnTransform(FRotator::ZeroRotator, GetMuzzleTransform().GetLocation());
-    AMSProjectile* Projectile = World->SpawnActorDeferred<AMSProjectile>(ProjectileClass, SpawnTransform);
+    const FTransform SpawnTransform(FRotator::ZeroRotator, SocketTransform.GetLocation());
+    AMSProjectile* Projectile = ActorPool->AcquireActorDeferred<AMSProjectile>(ProjectileClass, SpawnTransform, GetOwner());
     if (Projectile)
     {
         Projectile->SetShotDirection(SocketToEnd.GetSafeNormal());
-        Projectile->SetOwner(GetOwner());
-        Projectile->FinishSpawning(SpawnTransform);
+        ActorPool->FinishAcquire(Projectile);
     }
 
     DecreaseAmmo();
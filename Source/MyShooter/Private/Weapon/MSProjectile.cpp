@@ -2,9 +2,10 @@
 
 #include "Weapon/MSProjectile.h"
 #include "Components/MSWeaponFXComponent.h"
+#include "Core/MSActorPoolSubsystem.h"
+#include "Weapon/MSRadialDamageSubsystem.h"
 #include "Components/SphereComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
-#include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogProjectile, All, All);
@@ -35,32 +36,50 @@ void AMSProjectile::BeginPlay()
     check(MovementComponent);
     check(WeaponFXComponent);
 
-    CollisionComponent->IgnoreActorWhenMoving(GetOwner(), true);
     CollisionComponent->OnComponentHit.AddDynamic(this, &AMSProjectile::OnProjectileHit);
+}
 
+void AMSProjectile::OnPoolActivated()
+{
+    CollisionComponent->ClearMoveIgnoreActors();
+    CollisionComponent->IgnoreActorWhenMoving(GetOwner(), true);
+
+    MovementComponent->SetUpdatedComponent(CollisionComponent);
     MovementComponent->Velocity = ShotDirection * MovementComponent->InitialSpeed;
+    MovementComponent->SetComponentTickEnabled(true);
+
+    GetWorldTimerManager().SetTimer(LifeTimer, this, &AMSProjectile::ReturnToPool, LifeSeconds, false);
+}
 
-    SetLifeSpan(LifeSeconds);
+void AMSProjectile::OnPoolDeactivated()
+{
+    GetWorldTimerManager().ClearTimer(LifeTimer);
+
+    MovementComponent->StopMovementImmediately();
+    MovementComponent->SetComponentTickEnabled(false);
 }
 
 void AMSProjectile::OnProjectileHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
 {
     MovementComponent->StopMovementImmediately();
 
-    UGameplayStatics::ApplyRadialDamage(
-        GetWorld(),                 //
-        DamageAmount,               //
-        GetActorLocation(),         //
-        DamageRadius,               //
-        UDamageType::StaticClass(), //
-        { GetOwner() },             //
-        this,                       //
-        GetController(),            //
-        bDoFullDamage               //
-    );
+    if (UMSRadialDamageSubsystem* RadialDamage = GetWorld()->GetSubsystem<UMSRadialDamageSubsystem>())
+    {
+        FMSRadialDamageParams DamageParams;
+        DamageParams.BaseDamage = DamageAmount;
+        DamageParams.Origin = GetActorLocation();
+        DamageParams.Radius = DamageRadius;
+        DamageParams.FalloffCurve = DamageFalloffCurve;
+        DamageParams.bDoFullDamage = bDoFullDamage;
+        DamageParams.DamageCauser = this;
+        DamageParams.Instigator = GetController();
+        DamageParams.IgnoredActor = GetOwner();
+
+        RadialDamage->ApplyRadialDamage(DamageParams);
+    }
 
     WeaponFXComponent->PlayImpactFX(Hit);
-    Destroy();
+    ReturnToPool();
 }
 
 AController* AMSProjectile::GetController() const
@@ -68,3 +87,16 @@ AController* AMSProjectile::GetController() const
     const APawn* Pawn = Cast<APawn>(GetOwner());
     return Pawn ? Pawn->GetController() : nullptr;
 }
+
+void AMSProjectile::ReturnToPool()
+{
+    UWorld* World = GetWorld();
+    if (UMSActorPoolSubsystem* ActorPool = World ? World->GetSubsystem<UMSActorPoolSubsystem>() : nullptr)
+    {
+        ActorPool->ReleaseActor(this);
+    }
+    else
+    {
+        Destroy();
+    }
+}
@@ -0,0 +1,172 @@
+// MyShooter Game, All Rights Reserved.
+
+#include "Weapon/MSRadialDamageSubsystem.h"
+#include "AI/MSCombatantGridSubsystem.h"
+#include "Core/MSStats.h"
+#include "Curves/CurveFloat.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+
+void UMSRadialDamageSubsystem::ApplyRadialDamage(const FMSRadialDamageParams& Params)
+{
+    if (Params.BaseDamage <= 0.0f || Params.Radius <= 0.0f)
+    {
+        return;
+    }
+
+    QueuedRequests.Add(Params);
+}
+
+void UMSRadialDamageSubsystem::Deinitialize()
+{
+    QueuedRequests.Empty();
+    InFlightRequests.Empty();
+    InFlightTargets.Empty();
+    TraceDatum = FTraceDatum();
+    DamageEvent = FRadialDamageEvent();
+
+    Super::Deinitialize();
+}
+
+void UMSRadialDamageSubsystem::Tick(float DeltaTime)
+{
+    MS_SCOPE_CYCLE_COUNTER(RadialDamage);
+
+    // Occlusion traces sent on previous frame are ready now
+    ResolveTargets();
+    DispatchRequests();
+}
+
+bool UMSRadialDamageSubsystem::IsTickable() const
+{
+    return !HasAnyFlags(RF_ClassDefaultObject) && (QueuedRequests.Num() > 0 || InFlightRequests.Num() > 0);
+}
+
+TStatId UMSRadialDamageSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMSRadialDamageSubsystem, STATGROUP_Tickables);
+}
+
+void UMSRadialDamageSubsystem::ResolveTargets()
+{
+    UWorld* World = GetWorld();
+
+    for (const FDamageTarget& Target : InFlightTargets)
+    {
+        APawn* Pawn = Target.Pawn.Get();
+        if (!World || !Pawn)
+        {
+            continue;
+        }
+
+        const FMSRadialDamageParams& Params = InFlightRequests[Target.RequestIndex];
+
+        bool bOccluded = false;
+        if (World->QueryTraceData(Target.TraceHandle, TraceDatum))
+        {
+            bOccluded = TraceDatum.OutHits.Num() > 0;
+        }
+        else
+        {
+            // Occlusion with lost async result is traced again, so damage is not dropped silently
+            MS_INC_FRAME_COUNTER(Traces);
+            bOccluded = World->LineTraceTestByChannel(
+                Params.Origin,                     //
+                Target.Location,                   //
+                ECollisionChannel::ECC_Visibility, //
+                MakeOcclusionParams(Params, Pawn)  //
+            );
+        }
+
+        if (bOccluded)
+        {
+            continue;
+        }
+
+        DamageEvent.DamageTypeClass = Params.DamageType ? Params.DamageType : TSubclassOf<UDamageType>(UDamageType::StaticClass());
+        DamageEvent.Origin = Params.Origin;
+
+        // Damage is already scaled by falloff, so minimum damage keeps actor from scaling it again
+        DamageEvent.Params = FRadialDamageParams(Target.Damage, Target.Damage, 0.0f, Params.Radius, 1.0f);
+
+        const FVector HitNormal = (Params.Origin - Target.Location).GetSafeNormal();
+        DamageEvent.ComponentHits.Reset();
+        DamageEvent.ComponentHits.Emplace(Pawn, Cast<UPrimitiveComponent>(Pawn->GetRootComponent()), Target.Location, HitNormal);
+
+        Pawn->TakeDamage(Target.Damage, DamageEvent, Params.Instigator.Get(), Params.DamageCauser.Get());
+    }
+
+    InFlightTargets.Reset();
+    InFlightRequests.Reset();
+}
+
+void UMSRadialDamageSubsystem::DispatchRequests()
+{
+    UWorld* World = GetWorld();
+    const UMSCombatantGridSubsystem* CombatantGrid = World ? World->GetSubsystem<UMSCombatantGridSubsystem>() : nullptr;
+    if (!CombatantGrid)
+    {
+        QueuedRequests.Reset();
+        return;
+    }
+
+    Swap(QueuedRequests, InFlightRequests);
+
+    for (int32 RequestIndex = 0; RequestIndex < InFlightRequests.Num(); ++RequestIndex)
+    {
+        const FMSRadialDamageParams& Params = InFlightRequests[RequestIndex];
+
+        CombatantGrid->ForEachCombatantInRadius(Params.Origin, Params.Radius, [&](APawn* Pawn, const FVector& Location) { //
+            if (Pawn == Params.IgnoredActor.Get() || Pawn == Params.DamageCauser.Get())
+            {
+                return;
+            }
+
+            const float Damage = Params.BaseDamage * GetDamageScale(Params, FVector::Dist(Params.Origin, Location));
+            if (Damage <= 0.0f)
+            {
+                return;
+            }
+
+            FDamageTarget& Target = InFlightTargets.AddDefaulted_GetRef();
+            Target.RequestIndex = RequestIndex;
+            Target.Pawn = Pawn;
+            Target.Location = Location;
+            Target.Damage = Damage;
+            Target.TraceHandle = World->AsyncLineTraceByChannel(
+                EAsyncTraceType::Test,             //
+                Params.Origin,                     //
+                Location,                          //
+                ECollisionChannel::ECC_Visibility, //
+                MakeOcclusionParams(Params, Pawn)  //
+            );
+        });
+    }
+
+    MS_INC_FRAME_COUNTER_BY(Traces, InFlightTargets.Num());
+}
+
+FCollisionQueryParams UMSRadialDamageSubsystem::MakeOcclusionParams(const FMSRadialDamageParams& Params, const APawn* Pawn)
+{
+    // Target is occluded if anything except itself blocks visibility from origin
+    FCollisionQueryParams CollisionParams(SCENE_QUERY_STAT(MSRadialDamage), false, Params.DamageCauser.Get());
+    CollisionParams.AddIgnoredActor(Params.IgnoredActor.Get());
+    CollisionParams.AddIgnoredActor(Pawn);
+    return CollisionParams;
+}
+
+float UMSRadialDamageSubsystem::GetDamageScale(const FMSRadialDamageParams& Params, float Distance)
+{
+    if (Params.bDoFullDamage)
+    {
+        return 1.0f;
+    }
+
+    const float NormalizedDistance = FMath::Clamp(Distance / Params.Radius, 0.0f, 1.0f);
+    if (Params.FalloffCurve)
+    {
+        return FMath::Max(Params.FalloffCurve->GetFloatValue(NormalizedDistance), 0.0f);
+    }
+
+    return 1.0f - NormalizedDistance;
+}
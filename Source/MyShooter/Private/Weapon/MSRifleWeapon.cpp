@@ -3,9 +3,14 @@
 #include "Weapon/MSRifleWeapon.h"
 #include "Components/MSWeaponFXComponent.h"
 #include "Components/MSWeaponFlashlightComponent.h"
+#include "Weapon/MSHitscanSubsystem.h"
+#include "Weapon/MSFireSchedulerSubsystem.h"
+#include "Core/MSStats.h"
+#include "Dev/MSAllocationCounter.h"
 #include "NiagaraFunctionLibrary.h"
 #include "NiagaraComponent.h"
 #include "DrawDebugHelpers.h"
+#include "Misc/App.h"
 
 AMSRifleWeapon::AMSRifleWeapon()
 {
@@ -19,29 +24,25 @@ AMSRifleWeapon::AMSRifleWeapon()
 
 void AMSRifleWeapon::StartFire()
 {
+    UMSFireSchedulerSubsystem* FireScheduler = GetWorld()->GetSubsystem<UMSFireSchedulerSubsystem>();
+    if (!FireScheduler || FireScheduler->IsFiring(this))
+    {
+        return;
+    }
+
     ToggleMuzzleFXVisibility(true);
-    GetWorldTimerManager().SetTimer(ShotTimer, this, &AMSRifleWeapon::MakeShot, TimeBetweenShots, true);
+    FireScheduler->StartFiring(this, TimeBetweenShots);
     MakeShot();
 }
 
 void AMSRifleWeapon::StopFire()
 {
     ToggleMuzzleFXVisibility(false);
-    GetWorldTimerManager().ClearTimer(ShotTimer);
-}
-
-void AMSRifleWeapon::OnEquipped()
-{
-    Super::OnEquipped();
-
-    FlashlightComponent->OnEquipped();
-}
-
-void AMSRifleWeapon::OnUnequipped()
-{
-    Super::OnUnequipped();
 
-    FlashlightComponent->OnUnequipped();
+    if (UMSFireSchedulerSubsystem* FireScheduler = GetWorld()->GetSubsystem<UMSFireSchedulerSubsystem>())
+    {
+        FireScheduler->StopFiring(this);
+    }
 }
 
 void AMSRifleWeapon::BeginPlay()
@@ -57,21 +58,47 @@ void AMSRifleWeapon::BeginPlay()
 
 void AMSRifleWeapon::MakeShot()
 {
-    FVector TraceStart;
-    FVector TraceEnd;
-    FHitResult HitResult;
+    MakeScheduledShot(GetWorld()->GetTimeSeconds());
+}
+
+void AMSRifleWeapon::MakeScheduledShot(float ShotTime)
+{
+    MS_SCOPE_CYCLE_COUNTER(RifleMakeShot);
+    MS_SCOPE_ALLOCATION_COUNTER(RifleShot);
 
-    if (IsAmmoEmpty() || !GetTraceData(TraceStart, TraceEnd) || !MakeHit(HitResult, TraceStart, TraceEnd))
+    UWorld* World = GetWorld();
+    UMSHitscanSubsystem* HitscanSubsystem = World ? World->GetSubsystem<UMSHitscanSubsystem>() : nullptr;
+
+    FShotContext ShotContext;
+    if (IsAmmoEmpty() || !HitscanSubsystem || !MakeShotContext(ShotContext))
     {
         StopFire();
         return;
     }
 
-    FVector* TraceFXEnd = nullptr;
+    // Shots due earlier in the frame are traced from where the owner was at their shot time,
+    // muzzle transform stays as is for FX
+    const float ShotAge = World->GetTimeSeconds() - ShotTime;
+    const AActor* Owner = GetOwner();
+    if (ShotAge > 0.0f && Owner)
+    {
+        const FVector Offset = -Owner->GetVelocity() * ShotAge;
+        ShotContext.TraceStart += Offset;
+        ShotContext.TraceEnd += Offset;
+    }
+
+    // Trace, damage and FX are resolved by hitscan subsystem on the next frame
+    HitscanSubsystem->QueueShot(this, ShotContext);
+    DecreaseAmmo();
+}
+
+void AMSRifleWeapon::ResolveShot(const FShotContext& ShotContext, const FHitResult& HitResult)
+{
+    const FVector* TraceFXEnd = nullptr;
 
     if (HitResult.bBlockingHit)
     {
-        const FTransform SocketTransform = GetMuzzleTransform();
+        const FTransform& SocketTransform = ShotContext.MuzzleTransform;
         const FVector SocketDirection = SocketTransform.GetRotation().GetForwardVector();
         const FVector SocketToImpact = HitResult.ImpactPoint - SocketTransform.GetLocation();
 
@@ -86,34 +113,26 @@ void AMSRifleWeapon::MakeShot()
     }
     else
     {
-        TraceFXEnd = &TraceEnd;
+        TraceFXEnd = &ShotContext.TraceEnd;
     }
 
     if (TraceFXEnd)
     {
-        SpawnTraceFX(GetMuzzleTransform().GetLocation(), *TraceFXEnd);
+        SpawnTraceFX(ShotContext.MuzzleTransform.GetLocation(), *TraceFXEnd);
     }
-    DecreaseAmmo();
 }
 
-bool AMSRifleWeapon::GetTraceData(FVector& TraceStart, FVector& TraceEnd) const
+bool AMSRifleWeapon::GetTraceData(FShotContext& ShotContext) const
 {
-    FVector ViewLocation;
-    FRotator ViewRotation;
-    if (!GetPlayerViewPoint(ViewLocation, ViewRotation))
-    {
-        return false;
-    }
-
-    TraceStart = ViewLocation;
+    ShotContext.TraceStart = ShotContext.ViewLocation;
     const float HalfRad = FMath::DegreesToRadians(BulletSpread);
-    const FVector ShootDirection = FMath::VRandCone(ViewRotation.Vector(), HalfRad);
-    TraceEnd = TraceStart + ShootDirection * TraceMaxDistance;
+    const FVector ShootDirection = RandomStream.VRandCone(ShotContext.ViewRotation.Vector(), HalfRad);
+    ShotContext.TraceEnd = ShotContext.TraceStart + ShootDirection * TraceMaxDistance;
 
     return true;
 }
 
-void AMSRifleWeapon::MakeDamage(FHitResult& HitResult)
+void AMSRifleWeapon::MakeDamage(const FHitResult& HitResult)
 {
     if (AActor* Actor = HitResult.GetActor())
     {
@@ -132,7 +151,26 @@ void AMSRifleWeapon::ToggleMuzzleFXVisibility(bool bVisible)
 
 void AMSRifleWeapon::SpawnTraceFX(const FVector& TraceStart, const FVector& TraceEnd)
 {
-    if (const auto TraceFXComponent = UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), TraceFX, TraceStart))
+    if (!FApp::CanEverRender())
+    {
+        return;
+    }
+
+    MS_INC_FRAME_COUNTER(SpawnedFX);
+
+    // Finished tracers return their component to world niagara pool, so steady fire doesn't create components
+    const auto TraceFXComponent = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+        GetWorld(),                //
+        TraceFX,                   //
+        TraceStart,                //
+        FRotator::ZeroRotator,     //
+        FVector(1.0f),             //
+        true,                      //
+        true,                      //
+        ENCPoolMethod::AutoRelease //
+    );
+
+    if (TraceFXComponent)
     {
         TraceFXComponent->SetNiagaraVariableVec3(TraceTargetName, TraceEnd);
     }
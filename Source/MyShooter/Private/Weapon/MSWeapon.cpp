@@ -2,6 +2,9 @@
 
 #include "Weapon/MSWeapon.h"
 #include "Character/MSCharacter.h"
+#include "Dev/MSBenchmarkSubsystem.h"
+#include "Dev/MSReplaySubsystem.h"
+#include "Core/MSStats.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Gameframework/Character.h"
 #include "Gameframework/Controller.h"
@@ -34,20 +37,101 @@ void AMSWeapon::BeginPlay()
     check(WeaponMesh);
 
     CurrentAmmo = DefaultAmmo;
+
+    InitAccessories();
+}
+
+void AMSWeapon::OnEquipped()
+{
+    for (const FAccessorySlot& Slot : AccessorySlots)
+    {
+        if (Slot.Accessory)
+        {
+            Slot.Accessory->OnWeaponEquipped();
+        }
+    }
+}
+
+void AMSWeapon::OnUnequipped()
+{
+    for (const FAccessorySlot& Slot : AccessorySlots)
+    {
+        if (Slot.Accessory)
+        {
+            Slot.Accessory->OnWeaponUnequipped();
+        }
+    }
+}
+
+void AMSWeapon::OnPoolActivated()
+{
+    ResetAmmo();
+
+    if (UMSReplaySubsystem* Replay = GetWorld()->GetSubsystem<UMSReplaySubsystem>())
+    {
+        RandomStream = Replay->MakeRandomStream();
+    }
+}
+
+void AMSWeapon::OnPoolDeactivated()
+{
+    StopFire();
+    OnUnequipped();
+    OnClipEmpty.Clear();
+    OnAmmoChanged.Clear();
+
+    for (const FAccessorySlot& Slot : AccessorySlots)
+    {
+        if (Slot.Accessory)
+        {
+            Slot.Accessory->OnWeaponPoolDeactivated();
+        }
+    }
+
+    DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+}
+
+void AMSWeapon::InitAccessories()
+{
+    TInlineComponentArray<UActorComponent*> Components(this);
+    for (UActorComponent* Component : Components)
+    {
+        IMSWeaponAccessory* Accessory = Cast<IMSWeaponAccessory>(Component);
+        if (!Accessory)
+        {
+            continue;
+        }
+
+        FAccessorySlot& Slot = AccessorySlots[static_cast<int32>(Accessory->GetAccessorySlot())];
+        if (Slot.Component)
+        {
+            UE_LOG(LogWeapon, Warning, TEXT("%s has more than one accessory in slot of %s"), *GetName(), *Component->GetName());
+            continue;
+        }
+
+        Slot.Component = Component;
+        Slot.Accessory = Accessory;
+    }
 }
 
-bool AMSWeapon::GetTraceData(FVector& TraceStart, FVector& TraceEnd) const
+bool AMSWeapon::MakeShotContext(FShotContext& ShotContext) const
 {
-    FVector ViewLocation;
-    FRotator ViewRotation;
-    if (!GetPlayerViewPoint(ViewLocation, ViewRotation))
+    // Read muzzle socket only once per shot
+    ShotContext.MuzzleTransform = GetMuzzleTransform();
+
+    if (!GetPlayerViewPoint(ShotContext.MuzzleTransform, ShotContext.ViewLocation, ShotContext.ViewRotation))
     {
         return false;
     }
 
-    TraceStart = ViewLocation;
-    const FVector ShootDirection = ViewRotation.Vector();
-    TraceEnd = TraceStart + ShootDirection * TraceMaxDistance;
+    return GetTraceData(ShotContext);
+}
+
+bool AMSWeapon::GetTraceData(FShotContext& ShotContext) const
+{
+    ShotContext.TraceStart = ShotContext.ViewLocation;
+    const FVector ShootDirection = ShotContext.ViewRotation.Vector();
+    ShotContext.TraceEnd = ShotContext.TraceStart + ShootDirection * TraceMaxDistance;
 
     return true;
 }
@@ -60,6 +144,8 @@ bool AMSWeapon::MakeHit(FHitResult& HitResult, const FVector& TraceStart, const
         return false;
     }
 
+    MS_INC_FRAME_COUNTER(Traces);
+
     FCollisionQueryParams CollisionParams;
     CollisionParams.AddIgnoredActor(GetOwner());
     CollisionParams.bReturnPhysicalMaterial = true;
@@ -70,6 +156,8 @@ bool AMSWeapon::MakeHit(FHitResult& HitResult, const FVector& TraceStart, const
 
 UNiagaraComponent* AMSWeapon::SpawnMuzzleFX()
 {
+    MS_INC_FRAME_COUNTER(SpawnedFX);
+
     return UNiagaraFunctionLibrary::SpawnSystemAttached(
         MuzzleFX,                      //
         WeaponMesh,                    //
@@ -92,7 +180,7 @@ AController* AMSWeapon::GetPlayerController() const
     return Player->GetController<APlayerController>();
 }
 
-bool AMSWeapon::GetPlayerViewPoint(FVector& ViewLocation, FRotator& ViewRotation) const
+bool AMSWeapon::GetPlayerViewPoint(const FTransform& MuzzleTransform, FVector& ViewLocation, FRotator& ViewRotation) const
 {
     const auto Character = Cast<AMSCharacter>(GetOwner());
     if (!Character)
@@ -110,8 +198,8 @@ bool AMSWeapon::GetPlayerViewPoint(FVector& ViewLocation, FRotator& ViewRotation
     }
     else
     {
-        ViewLocation = GetMuzzleTransform().GetLocation();
-        ViewRotation = WeaponMesh->GetSocketRotation(MuzzleSocketName);
+        ViewLocation = MuzzleTransform.GetLocation();
+        ViewRotation = MuzzleTransform.Rotator();
         return true;
     }
 
@@ -127,6 +215,14 @@ void AMSWeapon::DecreaseAmmo()
     }
 
     --CurrentAmmo.Bullets;
+    OnAmmoChanged.Broadcast(this);
+
+    MS_INC_FRAME_COUNTER(Shots);
+
+    if (UMSBenchmarkSubsystem* Benchmark = GetWorld()->GetSubsystem<UMSBenchmarkSubsystem>())
+    {
+        Benchmark->AddShot();
+    }
 
     if (IsClipEmpty() && !IsAmmoEmpty())
     {
@@ -149,6 +245,13 @@ void AMSWeapon::ChangeClip()
     }
 
     CurrentAmmo.Bullets = DefaultAmmo.Bullets;
+    OnAmmoChanged.Broadcast(this);
+}
+
+void AMSWeapon::ResetAmmo()
+{
+    CurrentAmmo = DefaultAmmo;
+    OnAmmoChanged.Broadcast(this);
 }
 
 bool AMSWeapon::TryToAddAmmo(int32 Clips)
@@ -171,6 +274,8 @@ bool AMSWeapon::TryToAddAmmo(int32 Clips)
         CurrentAmmo.Clips = SumClips;
     }
 
+    OnAmmoChanged.Broadcast(this);
+
     if (bAmmoWasEmpty)
     {
         OnClipEmpty.Broadcast(this);
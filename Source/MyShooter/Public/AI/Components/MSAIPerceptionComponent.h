@@ -11,6 +11,17 @@ class MYSHOOTER_API UMSAIPerceptionComponent : public UAIPerceptionComponent
 {
     GENERATED_BODY()
 
+protected:
+    // Overridden by lose sight radius of sight sense config
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "AI", meta = (ClampMin = "0.0"))
+    float EnemySearchRadius = 3000.0f;
+
 public:
     AActor* GetClosestEnemy() const;
+
+    FORCEINLINE float GetEnemySearchRadius() const { return EnemySearchRadius; }
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(EEndPlayReason::Type Reason) override;
 };
@@ -0,0 +1,28 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EnvironmentQuery/EnvQueryGenerator.h"
+#include "EnvQueryGenerator_AvailablePickups.generated.h"
+
+class AMSPickup;
+
+// Generates only pickups of given class which can be taken now, taken from pickup subsystem registry
+UCLASS(meta = (DisplayName = "Available Pickups"))
+class MYSHOOTER_API UEnvQueryGenerator_AvailablePickups : public UEnvQueryGenerator
+{
+    GENERATED_BODY()
+
+protected:
+    UPROPERTY(EditDefaultsOnly, Category = "Generator")
+    TSubclassOf<AMSPickup> PickupClass;
+
+public:
+    UEnvQueryGenerator_AvailablePickups(const FObjectInitializer& ObjInit);
+
+    virtual void GenerateItems(FEnvQueryInstance& QueryInstance) const override;
+
+    virtual FText GetDescriptionTitle() const override;
+    virtual FText GetDescriptionDetails() const override;
+};
@@ -20,9 +20,17 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "AI")
     FName FocusedActorKeyName = "EnemyActor";
 
+private:
+    FRandomStream RandomStream;
+
 public:
     AMSAIController();
 
+    void ResetForRound();
+
+    // Random stream of bot decisions, seeded from match seed
+    const FRandomStream& GetRandomStream() const { return RandomStream; }
+
 protected:
     virtual void Tick(float DeltaTime) override;
     virtual void OnPossess(APawn* InPawn) override;
@@ -0,0 +1,98 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "MSAISenseSubsystem.generated.h"
+
+class AAIController;
+class UBehaviorTreeComponent;
+
+struct FMSSenseBlackboardKeys
+{
+    FName EnemyActor;
+    FName EnemyDistance;
+    FName HasLineOfFire;
+};
+
+/**
+ * Batched target selection of bots. Requests of a frame are resolved in three steps: read only snapshot
+ * of combatants is taken, best enemy of every bot is computed on worker threads, results are written to blackboards.
+ */
+UCLASS(Config = Game)
+class MYSHOOTER_API UMSAISenseSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+protected:
+    // Teammate closer than this to line between bot and its enemy blocks line of fire
+    UPROPERTY(Config)
+    float FriendlyFireClearance = 60.0f;
+
+private:
+    struct FSenseRequest
+    {
+        TWeakObjectPtr<UBehaviorTreeComponent> OwnerComp;
+        TWeakObjectPtr<AAIController> Controller;
+        FMSSenseBlackboardKeys Keys;
+    };
+
+    struct FSnapshotCombatant
+    {
+        APawn* Pawn;
+        FVector Location;
+        int32 TeamID;
+        float Health;
+    };
+
+    struct FSnapshotBot
+    {
+        const APawn* Pawn = nullptr;
+        FVector Location = FVector::ZeroVector;
+        int32 TeamID = 0;
+        float SearchRadius = 0.0f;
+        int32 FirstSeenIndex = 0;
+        int32 NumSeen = 0;
+        bool bValid = false;
+    };
+
+    struct FSenseResult
+    {
+        int32 EnemyIndex = INDEX_NONE;
+        float Distance = 0.0f;
+        bool bHasLineOfFire = false;
+    };
+
+    TArray<FSenseRequest> Requests;
+
+    // Snapshot and results are kept between frames to not reallocate them
+    TArray<FSnapshotCombatant> SnapshotCombatants;
+    TMap<const AActor*, int32> SnapshotIndices;
+    TArray<FSnapshotBot> SnapshotBots;
+    TArray<int32> SeenIndices;
+    TArray<FSenseResult> Results;
+
+public:
+    static bool IsEnabled();
+
+    void RequestSense(UBehaviorTreeComponent& OwnerComp, const FMSSenseBlackboardKeys& Keys);
+
+    void RunBenchmark(int32 Iterations);
+
+    virtual void Deinitialize() override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override;
+    virtual TStatId GetStatId() const override;
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+private:
+    void BuildSnapshot(const TArray<FSenseRequest>& InRequests);
+    void ComputeResults(bool bParallel);
+    void WriteResults() const;
+
+    FSenseResult ComputeResult(const FSnapshotBot& Bot) const;
+    bool HasLineOfFire(const FSnapshotBot& Bot, const FVector& EnemyLocation) const;
+};
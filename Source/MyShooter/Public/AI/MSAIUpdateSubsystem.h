@@ -0,0 +1,63 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "MSAIUpdateSubsystem.generated.h"
+
+class UBehaviorTreeComponent;
+class UMSScheduledService;
+
+/**
+ * Updates scheduled behavior tree services of all bots round robin within per frame time budget,
+ * so service updates of many bots don't line up on the same frames. Tracks how late updates are.
+ * Recorded and replayed matches use fixed update count per frame instead, so bot decisions don't depend on build speed.
+ */
+UCLASS(Config = Game)
+class MYSHOOTER_API UMSAIUpdateSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+protected:
+    UPROPERTY(Config)
+    float FrameBudgetMs = 0.5f;
+
+    UPROPERTY(Config)
+    int32 ReplayUpdatesPerFrame = 8;
+
+private:
+    struct FWorkItem
+    {
+        TWeakObjectPtr<UBehaviorTreeComponent> OwnerComp;
+        const UMSScheduledService* Service = nullptr;
+        uint8* NodeMemory = nullptr;
+        float Interval = 0.0f;
+        double LastUpdateTime = 0.0;
+
+        float MaxStaleness = 0.0f;
+        float StalenessSum = 0.0f;
+        int32 NumUpdates = 0;
+    };
+
+    TArray<FWorkItem> WorkItems;
+    int32 NextItemIndex = 0;
+    bool bUpdating = false;
+
+public:
+    void AddWorkItem(UBehaviorTreeComponent& OwnerComp, const UMSScheduledService* Service, uint8* NodeMemory, float Interval);
+    void RemoveWorkItem(UBehaviorTreeComponent& OwnerComp, const UMSScheduledService* Service, uint8* NodeMemory);
+
+    void LogStats() const;
+
+    virtual void Deinitialize() override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override;
+    virtual TStatId GetStatId() const override;
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+private:
+    void RemoveInvalidItems();
+};
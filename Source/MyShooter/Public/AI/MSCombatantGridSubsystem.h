@@ -0,0 +1,155 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "MSCombatantGridSubsystem.generated.h"
+
+/**
+ * Uniform grid of living combatants keyed by team. Characters are added on BeginPlay,
+ * removed on death and cells are updated when they move.
+ */
+UCLASS()
+class MYSHOOTER_API UMSCombatantGridSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+private:
+    struct FCombatant
+    {
+        APawn* Pawn;
+        FVector Location;
+        FIntVector CellKey;
+    };
+
+    using FCell = TArray<int32, TInlineAllocator<8>>;
+
+    static constexpr float CellSize = 1000.0f;
+
+    TArray<FCombatant> Combatants;
+    TMap<const APawn*, int32> CombatantIndices;
+    TMap<FIntVector, FCell> Cells;
+    TArray<int32, TInlineAllocator<4>> Teams;
+
+public:
+    void AddCombatant(APawn* Pawn);
+    void RemoveCombatant(APawn* Pawn);
+
+    // Returns closest living combatant not in TeamID within Radius, Filter is called only for closer candidates
+    template<typename FilterType>
+    APawn* FindClosestEnemy(const FVector& Origin, int32 TeamID, float Radius, FilterType&& Filter) const;
+
+    APawn* FindClosestEnemy(const FVector& Origin, int32 TeamID, float Radius) const
+    {
+        return FindClosestEnemy(Origin, TeamID, Radius, [](const APawn*) { return true; });
+    }
+
+    // Calls Visitor with every living combatant of any team within Radius and its location
+    template<typename VisitorType>
+    void ForEachCombatantInRadius(const FVector& Origin, float Radius, VisitorType&& Visitor) const;
+
+    // Calls Visitor with every living combatant, its location and team
+    template<typename VisitorType>
+    void ForEachCombatant(VisitorType&& Visitor) const
+    {
+        for (const FCombatant& Combatant : Combatants)
+        {
+            Visitor(Combatant.Pawn, Combatant.Location, Combatant.CellKey.Z);
+        }
+    }
+
+    FORCEINLINE int32 GetNumCombatants() const { return Combatants.Num(); }
+
+    virtual void Deinitialize() override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override;
+    virtual TStatId GetStatId() const override;
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+private:
+    static int32 GetTeamID(const APawn* Pawn);
+    static FIntVector GetCellKey(const FVector& Location, int32 TeamID);
+
+    void AddToCell(int32 Index);
+    void RemoveFromCell(int32 Index);
+};
+
+template<typename FilterType>
+APawn* UMSCombatantGridSubsystem::FindClosestEnemy(const FVector& Origin, int32 TeamID, float Radius, FilterType&& Filter) const
+{
+    const FIntVector MinKey = GetCellKey(Origin - FVector(Radius), 0);
+    const FIntVector MaxKey = GetCellKey(Origin + FVector(Radius), 0);
+
+    float BestDistanceSquared = FMath::Square(Radius);
+    APawn* BestPawn = nullptr;
+
+    for (const int32 OtherTeamID : Teams)
+    {
+        // Team 0 is not assigned yet, everyone is enemy for it
+        if (TeamID != 0 && OtherTeamID == TeamID)
+        {
+            continue;
+        }
+
+        for (int32 X = MinKey.X; X <= MaxKey.X; ++X)
+        {
+            for (int32 Y = MinKey.Y; Y <= MaxKey.Y; ++Y)
+            {
+                const FCell* Cell = Cells.Find(FIntVector(X, Y, OtherTeamID));
+                if (!Cell)
+                {
+                    continue;
+                }
+
+                for (const int32 Index : *Cell)
+                {
+                    const FCombatant& Combatant = Combatants[Index];
+                    const float DistanceSquared = FVector::DistSquared(Origin, Combatant.Location);
+
+                    if (DistanceSquared < BestDistanceSquared && Filter(Combatant.Pawn))
+                    {
+                        BestDistanceSquared = DistanceSquared;
+                        BestPawn = Combatant.Pawn;
+                    }
+                }
+            }
+        }
+    }
+
+    return BestPawn;
+}
+
+template<typename VisitorType>
+void UMSCombatantGridSubsystem::ForEachCombatantInRadius(const FVector& Origin, float Radius, VisitorType&& Visitor) const
+{
+    const FIntVector MinKey = GetCellKey(Origin - FVector(Radius), 0);
+    const FIntVector MaxKey = GetCellKey(Origin + FVector(Radius), 0);
+    const float RadiusSquared = FMath::Square(Radius);
+
+    for (const int32 TeamID : Teams)
+    {
+        for (int32 X = MinKey.X; X <= MaxKey.X; ++X)
+        {
+            for (int32 Y = MinKey.Y; Y <= MaxKey.Y; ++Y)
+            {
+                const FCell* Cell = Cells.Find(FIntVector(X, Y, TeamID));
+                if (!Cell)
+                {
+                    continue;
+                }
+
+                for (const int32 Index : *Cell)
+                {
+                    const FCombatant& Combatant = Combatants[Index];
+                    if (FVector::DistSquared(Origin, Combatant.Location) <= RadiusSquared)
+                    {
+                        Visitor(Combatant.Pawn, Combatant.Location);
+                    }
+                }
+            }
+        }
+    }
+}
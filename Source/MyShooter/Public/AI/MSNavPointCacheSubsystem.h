@@ -0,0 +1,76 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "MSNavPointCacheSubsystem.generated.h"
+
+class ANavigationData;
+
+/**
+ * Keeps reservoir of pre-sampled reachable navmesh points per region, so bots draw roam locations
+ * without synchronous navmesh queries. Reservoirs are refilled over frames and dropped on navmesh rebuild.
+ */
+UCLASS(Config = Game)
+class MYSHOOTER_API UMSNavPointCacheSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+protected:
+    UPROPERTY(Config)
+    float RegionSize = 1500.0f;
+
+    UPROPERTY(Config)
+    int32 PointsPerRegion = 32;
+
+    // Full region replaces this many of its points per refresh
+    UPROPERTY(Config)
+    int32 PointsPerRefresh = 4;
+
+    // Full region is refreshed after PointsPerRefresh * DrawsPerReplacedPoint draws,
+    // so steady state costs one navmesh query per this many draws
+    UPROPERTY(Config)
+    int32 DrawsPerReplacedPoint = 8;
+
+    UPROPERTY(Config)
+    int32 MaxSamplesPerFrame = 8;
+
+    UPROPERTY(Config)
+    int32 MaxDrawAttempts = 4;
+
+private:
+    struct FRegion
+    {
+        // Location known to be near navmesh, points are sampled around it
+        FVector Anchor = FVector::ZeroVector;
+        TArray<FVector> Points;
+        int32 NextReplaceIndex = 0;
+        int32 NumDrawsSinceRefill = 0;
+        int32 NumPendingSamples = 0;
+        bool bQueued = false;
+    };
+
+    TMap<FIntVector, FRegion> Regions;
+    TArray<FIntVector> RefillQueue;
+
+public:
+    // Draws cached reachable point within Radius from Origin, returns false if cache has no such point yet
+    bool DrawPoint(const FVector& Origin, float Radius, const FRandomStream& RandomStream, FVector& OutPoint);
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override;
+    virtual TStatId GetStatId() const override;
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+private:
+    FIntVector GetRegionKey(const FVector& Location) const;
+    void QueueRefill(const FIntVector& RegionKey, FRegion& Region);
+
+    UFUNCTION()
+    void OnNavigationGenerationFinished(ANavigationData* NavData);
+};
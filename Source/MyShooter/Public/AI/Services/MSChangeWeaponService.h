@@ -3,11 +3,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "BehaviorTree/BTService.h"
+#include "AI/Services/MSScheduledService.h"
 #include "MSChangeWeaponService.generated.h"
 
 UCLASS()
-class MYSHOOTER_API UMSChangeWeaponService : public UBTService
+class MYSHOOTER_API UMSChangeWeaponService : public UMSScheduledService
 {
     GENERATED_BODY()
 
@@ -19,15 +19,18 @@ public:
     float TimeRateBetweenTicks = 5.0f;
 
 private:
-    bool bCanTick = true;
-    FTimerHandle Timer;
+    // Service node is shared by all bots, so cooldown is kept in node memory of each bot
+    struct FChangeWeaponMemory
+    {
+        float CooldownLeft;
+    };
 
 public:
     UMSChangeWeaponService();
 
-protected:
-	virtual void TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
+    virtual void ScheduledTick(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) const override;
+    virtual uint16 GetInstanceMemorySize() const override { return sizeof(FChangeWeaponMemory); }
 
-private:
-    FORCEINLINE void OnCanTickAgain() { bCanTick = true; }
+protected:
+    virtual void OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
 };
@@ -3,11 +3,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "BehaviorTree/BTService.h"
+#include "AI/Services/MSScheduledService.h"
 #include "MSFindEnemyService.generated.h"
 
 UCLASS()
-class MYSHOOTER_API UMSFindEnemyService : public UBTService
+class MYSHOOTER_API UMSFindEnemyService : public UMSScheduledService
 {
     GENERATED_BODY()
 
@@ -15,9 +15,16 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
     FBlackboardKeySelector EnemyActorKey;
 
+    // Optional, written only by parallel sense phase
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
+    FBlackboardKeySelector EnemyDistanceKey;
+
+    // Optional, written only by parallel sense phase
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
+    FBlackboardKeySelector HasLineOfFireKey;
+
 public:
     UMSFindEnemyService();
 
-protected:
-	virtual void TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
+    virtual void ScheduledTick(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) const override;
 };
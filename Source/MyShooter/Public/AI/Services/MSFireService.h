@@ -3,11 +3,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "BehaviorTree/BTService.h"
+#include "AI/Services/MSScheduledService.h"
 #include "MSFireService.generated.h"
 
 UCLASS()
-class MYSHOOTER_API UMSFireService : public UBTService
+class MYSHOOTER_API UMSFireService : public UMSScheduledService
 {
     GENERATED_BODY()
 
@@ -18,6 +18,5 @@ protected:
 public:
     UMSFireService();
 
-protected:
-	virtual void TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
+    virtual void ScheduledTick(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) const override;
 };
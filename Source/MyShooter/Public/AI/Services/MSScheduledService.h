@@ -0,0 +1,23 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/BTService.h"
+#include "MSScheduledService.generated.h"
+
+// Service which is updated by AI update subsystem within its frame budget instead of ticking by itself
+UCLASS(Abstract)
+class MYSHOOTER_API UMSScheduledService : public UBTService
+{
+    GENERATED_BODY()
+
+public:
+    UMSScheduledService();
+
+    virtual void ScheduledTick(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) const {}
+
+protected:
+    virtual void OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+    virtual void OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+};
@@ -6,15 +6,12 @@
 #include "Animation/AnimNotifies/AnimNotify.h"
 #include "MSAnimNotify.generated.h"
 
-DECLARE_MULTICAST_DELEGATE_OneParam(FOnNotifiedSignature, USkeletalMeshComponent*);
-
 UCLASS()
 class MYSHOOTER_API UMSAnimNotify : public UAnimNotify
 {
     GENERATED_BODY()
 
 public:
-	virtual void Notify(USkeletalMeshComponent* MeshComponent, UAnimSequenceBase* Animation) override;
-
-    FOnNotifiedSignature OnNotified;
+    // Notify is dispatched by anim notify router to the listener of notified mesh
+    virtual void Notify(USkeletalMeshComponent* MeshComponent, UAnimSequenceBase* Animation) override;
 };
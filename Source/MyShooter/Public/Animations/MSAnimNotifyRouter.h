@@ -0,0 +1,53 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UMSAnimNotify;
+class USkeletalMeshComponent;
+
+DECLARE_DELEGATE_OneParam(FMSAnimNotifyDelegate, USkeletalMeshComponent*);
+
+// Dispatches MyShooter anim notifies to the one listener registered for notified mesh and notify class or its parent.
+// Notify objects belong to montage assets and are shared by all characters, so they don't hold listeners themselves.
+class MYSHOOTER_API FMSAnimNotifyRouter
+{
+private:
+    struct FListener
+    {
+        const UClass* NotifyClass;
+        FMSAnimNotifyDelegate Delegate;
+    };
+
+    using FMeshListeners = TArray<FListener, TInlineAllocator<2>>;
+
+    TMap<const USkeletalMeshComponent*, FMeshListeners> MeshListeners;
+
+    int64 NumNotifies = 0;
+    int64 NumCallbacks = 0;
+    int64 NumUnrouted = 0;
+
+public:
+    static FMSAnimNotifyRouter& Get();
+
+    template<typename NotifyType>
+    void Register(const USkeletalMeshComponent* Mesh, const FMSAnimNotifyDelegate& Delegate)
+    {
+        Register(Mesh, NotifyType::StaticClass(), Delegate);
+    }
+
+    template<typename NotifyType>
+    void Unregister(const USkeletalMeshComponent* Mesh)
+    {
+        Unregister(Mesh, NotifyType::StaticClass());
+    }
+
+    void Register(const USkeletalMeshComponent* Mesh, const UClass* NotifyClass, const FMSAnimNotifyDelegate& Delegate);
+    void Unregister(const USkeletalMeshComponent* Mesh, const UClass* NotifyClass);
+
+    void Dispatch(const UMSAnimNotify* Notify, USkeletalMeshComponent* Mesh);
+
+    void LogStats() const;
+    void ResetStats();
+};
@@ -9,6 +9,18 @@
 DECLARE_MULTICAST_DELEGATE(FOnDeathSignature);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnHealthChangedSignature, float, float);
 
+class UDamageType;
+class AController;
+
+struct FMSDamageRecord
+{
+    float Damage = 0.0f;
+    float Time = 0.0f;
+    const UDamageType* DamageType = nullptr;
+    TWeakObjectPtr<AController> InstigatedBy;
+    TWeakObjectPtr<AActor> DamageCauser;
+};
+
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class MYSHOOTER_API UMSHealthComponent : public UActorComponent
 {
@@ -22,6 +34,10 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Health", meta = (ClampMin = "0.0001", ClampMax = "1000.0"))
     float MaxHealth = 100.0f;
 
+    // Collect damage during the frame and apply it once at the end of frame
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Health")
+    bool bCoalesceDamage = false;
+
     UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "AutoHeal")
     bool bAutoHeal = true;
 
@@ -31,6 +47,7 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "AutoHeal", meta = (EditCondition = "bAutoHeal"))
     float AutoHealDelayTime = 3.0f;
 
+    // Health healed per AutoHealUpdateTime, regeneration subsystem heals at this rate on its own interval
     UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "AutoHeal", meta = (EditCondition = "bAutoHeal"))
     float AutoHealModifier = 1.0f;
 
@@ -40,7 +57,9 @@ protected:
 private:
     float Health = 0.0f;
 
-    FTimerHandle AutoHealTimer;
+    TArray<FMSDamageRecord> PendingDamage;
+    TArray<FMSDamageRecord> DamageLog;
+    int32 KillingDamageIndex = INDEX_NONE;
 
 public:
     UMSHealthComponent();
@@ -55,17 +74,26 @@ public:
     FORCEINLINE bool IsHealthFull() const { return FMath::IsNearlyEqual(Health, MaxHealth); }
 
     bool TryToAddHealth(float InHealth);
+    void ResetHealth();
+
+    // Damage events applied by the last health change, one event without coalesced damage
+    const TArray<FMSDamageRecord>& GetDamageLog() const { return DamageLog; }
+    const FMSDamageRecord* GetKillingDamage() const;
+
+    void ResolvePendingDamage();
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(EEndPlayReason::Type Reason) override;
 
     UFUNCTION()
     void OnTakeAnyDamage(AActor* DamagedActor, float Damage, const class UDamageType* DamageType, class AController* InstigatedBy, AActor* DamageCauser);
 
 private:
     void SetHealth(float InHealth);
+    void ApplyDamageLog();
 
-    void OnAutoHealUpdateTimerFired();
+    void StopRegeneration();
 
     void PlayCameraShake();
 };
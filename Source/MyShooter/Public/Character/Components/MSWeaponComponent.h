@@ -7,6 +7,8 @@
 #include "Weapon/MSWeapon.h"
 #include "MSWeaponComponent.generated.h"
 
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnWeaponChangedSignature, AMSWeapon*);
+
 USTRUCT(BlueprintType)
 struct FWeaponData
 {
@@ -24,6 +26,10 @@ class MYSHOOTER_API UMSWeaponComponent : public UActorComponent
 {
     GENERATED_BODY()
 
+public:
+    FOnWeaponChangedSignature OnWeaponChanged;
+    FOnAmmoChangedSignature OnAmmoChanged;
+
 protected:
     UPROPERTY(EditDefaultsOnly, Category = "Weapon")
     TArray<FWeaponData> WeaponData;
@@ -46,6 +52,14 @@ protected:
     TArray<AMSWeapon*> Weapons;
 
 private:
+    struct FWeaponEquipData
+    {
+        UAnimMontage* ReloadAnimMontage = nullptr;
+    };
+
+    // Indexed like Weapons, filled on spawn
+    TArray<FWeaponEquipData> WeaponEquipData;
+
     UPROPERTY()
     UAnimMontage* CurrentReloadAnimMontage = nullptr;
 
@@ -61,6 +75,7 @@ public:
 
     FORCEINLINE void Reload() { ChangeClip(); }
     bool TryToAddAmmo(TSubclassOf<AMSWeapon> WeaponClass, int32 Clips);
+    void ResetWeapons();
 
     void ToggleFlashlight();
 
@@ -90,5 +105,6 @@ private:
 
     void ChangeClip();
     void OnEmptyClip(AMSWeapon* Weapon);
+    void OnWeaponAmmoChanged(AMSWeapon* Weapon);
 };
 
@@ -56,7 +56,6 @@ private:
 public:
     AMSCharacter(const FObjectInitializer& ObjInit);
 
-    virtual void Tick(float DeltaTime) override;
     virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
     UFUNCTION(BlueprintCallable, Category = "Movement")
@@ -65,10 +64,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Movement")
     float GetMovementDirection() const;
 
-    void SetCharacterColor(const FLinearColor& Color);
+    // Material is shared by characters of the same team, so recoloring doesn't create material instances
+    void SetCharacterMaterial(UMaterialInterface* Material);
+    UMaterialInterface* GetBaseMaterial() const;
+    FName GetMaterialColorName() const { return MaterialColorName; }
+
+    // Resets living character for next round without respawn, returns false if character is dead
+    bool ResetForRound();
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(EEndPlayReason::Type Reason) override;
 
     virtual void OnDeath();
 
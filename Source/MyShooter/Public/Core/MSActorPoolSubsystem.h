@@ -0,0 +1,65 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MSActorPoolSubsystem.generated.h"
+
+USTRUCT()
+struct FMSActorPool
+{
+    GENERATED_USTRUCT_BODY()
+
+    UPROPERTY()
+    TArray<AActor*> FreeActors;
+
+    int32 NumSpawned = 0;
+    int32 NumReused = 0;
+    int32 NumActive = 0;
+};
+
+UCLASS()
+class MYSHOOTER_API UMSActorPoolSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+private:
+    UPROPERTY()
+    TMap<UClass*, FMSActorPool> Pools;
+
+public:
+    void Prewarm(UClass* Class, int32 Count);
+
+    // Takes actor from pool or spawns new one, FinishAcquire should be called after setup
+    AActor* AcquireActorDeferred(UClass* Class, const FTransform& Transform, AActor* Owner = nullptr);
+    void FinishAcquire(AActor* Actor);
+
+    void ReleaseActor(AActor* Actor);
+
+    template<typename T>
+    T* AcquireActorDeferred(TSubclassOf<T> Class, const FTransform& Transform, AActor* Owner = nullptr)
+    {
+        return Cast<T>(AcquireActorDeferred(Class.Get(), Transform, Owner));
+    }
+
+    template<typename T>
+    T* AcquireActor(TSubclassOf<T> Class, const FTransform& Transform, AActor* Owner = nullptr)
+    {
+        T* Actor = AcquireActorDeferred<T>(Class, Transform, Owner);
+        if (Actor)
+        {
+            FinishAcquire(Actor);
+        }
+        return Actor;
+    }
+
+    const FMSActorPool* GetPoolStats(UClass* Class) const { return Pools.Find(Class); }
+    void LogPoolStats() const;
+
+    virtual void Deinitialize() override;
+
+private:
+    AActor* SpawnPooledActor(UClass* Class, const FTransform& Transform, AActor* Owner);
+    void DeactivateActor(AActor* Actor);
+};
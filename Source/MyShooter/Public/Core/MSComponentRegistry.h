@@ -0,0 +1,46 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "GameFramework/Actor.h"
+#include "Core/CoreUtils.h"
+
+// Per actor typed component lookup. MyShooter components register themselves on BeginPlay
+// and unregister on EndPlay, so lookup is one hash by actor and one index by type slot.
+class MYSHOOTER_API FMSComponentRegistry
+{
+private:
+    using FComponentSlots = TArray<UActorComponent*, TInlineAllocator<8>>;
+
+    TMap<const UClass*, int32> ClassSlots;
+    TMap<const AActor*, FComponentSlots> ActorComponents;
+
+public:
+    static FMSComponentRegistry& Get();
+
+    void Register(UActorComponent* Component);
+    void Unregister(UActorComponent* Component);
+
+    template<typename T>
+    static T* GetComponent(AActor* Actor)
+    {
+        if (!Actor)
+        {
+            return nullptr;
+        }
+
+        static const int32 Slot = Get().FindOrAddSlot(T::StaticClass());
+
+        const FComponentSlots* Slots = Get().ActorComponents.Find(Actor);
+        if (!Slots)
+        {
+            // Actor components haven't begun play yet, fallback to search
+            return FCoreUtils::GetActorComponent<T>(Actor);
+        }
+
+        return Slots->IsValidIndex(Slot) ? static_cast<T*>((*Slots)[Slot]) : nullptr;
+    }
+
+private:
+    int32 FindOrAddSlot(const UClass* Class);
+};
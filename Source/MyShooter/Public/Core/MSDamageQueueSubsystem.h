@@ -0,0 +1,33 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MSDamageQueueSubsystem.generated.h"
+
+class UMSHealthComponent;
+
+/**
+ * Resolves damage collected by health components with coalesced damage once at the end of frame,
+ * so every damaged actor gets one health change, one broadcast and one death check per frame
+ */
+UCLASS()
+class MYSHOOTER_API UMSDamageQueueSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+private:
+    TArray<TWeakObjectPtr<UMSHealthComponent>> PendingTargets;
+    FDelegateHandle PostActorTickHandle;
+
+public:
+    // Health component adds itself once on its first pending damage in the frame
+    void AddTarget(UMSHealthComponent* HealthComponent);
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+private:
+    void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+};
@@ -0,0 +1,25 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "MSPoolableActor.generated.h"
+
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UMSPoolableActor : public UInterface
+{
+    GENERATED_BODY()
+};
+
+class MYSHOOTER_API IMSPoolableActor
+{
+    GENERATED_BODY()
+
+public:
+    // Called when actor is taken from pool, gameplay state should be reset here
+    virtual void OnPoolActivated() {}
+
+    // Called when actor is returned to pool
+    virtual void OnPoolDeactivated() {}
+};
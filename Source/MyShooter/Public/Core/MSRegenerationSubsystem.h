@@ -0,0 +1,55 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "MSRegenerationSubsystem.generated.h"
+
+class UMSHealthComponent;
+
+/**
+ * Heals all regenerating health components in one pass at fixed interval.
+ * Components start regeneration on damage and stop it on death or full health
+ */
+UCLASS(Config = Game)
+class MYSHOOTER_API UMSRegenerationSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+protected:
+    UPROPERTY(Config)
+    float UpdateInterval = 0.25f;
+
+private:
+    struct FRegenerationEntry
+    {
+        UMSHealthComponent* HealthComponent = nullptr;
+        float HealStartTime = 0.0f;
+        float Rate = 0.0f;
+        float MaxHealth = 0.0f;
+    };
+
+    TArray<FRegenerationEntry> Entries;
+    TMap<const UMSHealthComponent*, int32> EntryIndices;
+
+    float LastUpdateTime = 0.0f;
+    bool bUpdating = false;
+    bool bHasStoppedEntries = false;
+
+public:
+    // Restarts delay if component is already regenerating, Rate is health per second
+    void StartRegeneration(UMSHealthComponent* HealthComponent, float Delay, float Rate, float MaxHealth);
+    void StopRegeneration(const UMSHealthComponent* HealthComponent);
+
+    virtual void Deinitialize() override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override;
+    virtual TStatId GetStatId() const override;
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+private:
+    void RemoveStoppedEntries();
+};
@@ -0,0 +1,78 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "Components/SkinnedMeshComponent.h"
+#include "MSSignificanceSubsystem.generated.h"
+
+class AMSCharacter;
+
+enum class EMSSignificance : uint8
+{
+    High,
+    Medium,
+    Low
+};
+
+/**
+ * Scores characters by distance to local viewpoints and combat state and lowers
+ * controller tick rate and mesh animation update rate of less significant ones
+ */
+UCLASS(Config = Game)
+class MYSHOOTER_API UMSSignificanceSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+protected:
+    UPROPERTY(Config)
+    float UpdateInterval = 0.25f;
+
+    UPROPERTY(Config)
+    float HighSignificanceDistance = 2000.0f;
+
+    UPROPERTY(Config)
+    float MediumSignificanceDistance = 5000.0f;
+
+    UPROPERTY(Config)
+    float MediumTickInterval = 0.1f;
+
+    UPROPERTY(Config)
+    float LowTickInterval = 0.25f;
+
+private:
+    struct FSignificanceEntry
+    {
+        AMSCharacter* Character = nullptr;
+        const AController* Controller = nullptr;
+        EMSSignificance Significance = EMSSignificance::High;
+        bool bInCombat = false;
+
+        // Mesh settings of high significance
+        bool bDefaultUpdateRateOptimizations = false;
+        EVisibilityBasedAnimTickOption DefaultAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+    };
+
+    TArray<FSignificanceEntry> Entries;
+    float TimeSinceUpdate = 0.0f;
+
+public:
+    void AddCharacter(AMSCharacter* Character);
+    void RemoveCharacter(AMSCharacter* Character);
+
+    virtual void Deinitialize() override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override;
+    virtual TStatId GetStatId() const override;
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+private:
+    EMSSignificance GetSignificance(
+        const AMSCharacter* Character, bool bInCombat, const TArray<FVector, TInlineAllocator<4>>& ViewLocations) const;
+    void ApplySignificance(const FSignificanceEntry& Entry) const;
+
+    static bool IsInCombat(const AMSCharacter* Character);
+};
@@ -0,0 +1,53 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+DECLARE_STATS_GROUP(TEXT("MyShooter"), STATGROUP_MyShooter, STATCAT_Advanced);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(MYSHOOTER_API, MyShooter);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Rifle MakeShot"), STAT_MS_RifleMakeShot, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Launcher MakeShot"), STAT_MS_LauncherMakeShot, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PlayImpactFX"), STAT_MS_PlayImpactFX, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetClosestEnemy"), STAT_MS_GetClosestEnemy, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("FindEnemyService Tick"), STAT_MS_FindEnemyService, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("FireService Tick"), STAT_MS_FireService, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ChangeWeaponService Tick"), STAT_MS_ChangeWeaponService, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OnTakeAnyDamage"), STAT_MS_OnTakeAnyDamage, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ResetPlayers"), STAT_MS_ResetPlayers, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI Update"), STAT_MS_AIUpdate, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Fire Scheduler"), STAT_MS_FireScheduler, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Radial Damage"), STAT_MS_RadialDamage, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Resolve Damage Queue"), STAT_MS_ResolveDamageQueue, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Regeneration"), STAT_MS_Regeneration, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Significance"), STAT_MS_Significance, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI Sense"), STAT_MS_AISense, STATGROUP_MyShooter, MYSHOOTER_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Shots"), STAT_MS_Shots, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Traces"), STAT_MS_Traces, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Impacts"), STAT_MS_Impacts, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Spawned FX"), STAT_MS_SpawnedFX, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI Updates"), STAT_MS_AIUpdates, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Nav Point Cache Hits"), STAT_MS_NavPointCacheHits, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Nav Point Cache Misses"), STAT_MS_NavPointCacheMisses, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Damaged Actors"), STAT_MS_DamagedActors, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sensed Bots"), STAT_MS_SensedBots, STATGROUP_MyShooter, MYSHOOTER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Anim Notify Callbacks"), STAT_MS_AnimNotifyCallbacks, STATGROUP_MyShooter, MYSHOOTER_API);
+
+// Cycle stat, CSV timing stat and Insights scope with the same name, e.g. MS_SCOPE_CYCLE_COUNTER(RifleMakeShot)
+#define MS_SCOPE_CYCLE_COUNTER(Name)                \
+    SCOPE_CYCLE_COUNTER(STAT_MS_##Name);            \
+    CSV_SCOPED_TIMING_STAT(MyShooter, Name);        \
+    TRACE_CPUPROFILER_EVENT_SCOPE(MyShooter_##Name)
+
+// Per frame counter in stats and CSV, e.g. MS_INC_FRAME_COUNTER(Shots)
+#define MS_INC_FRAME_COUNTER(Name) MS_INC_FRAME_COUNTER_BY(Name, 1)
+
+#define MS_INC_FRAME_COUNTER_BY(Name, Amount)      \
+    INC_DWORD_STAT_BY(STAT_MS_##Name, Amount);     \
+    CSV_CUSTOM_STAT(MyShooter, Name, Amount, ECsvCustomStatOp::Accumulate)
@@ -0,0 +1,75 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+class FMSAllocationScope;
+
+/**
+ * Counts game thread heap allocations made inside named scopes, e.g. per shot or per AI update.
+ * Global allocator is wrapped once on module startup with -MSCountAllocations, counting is toggled by MyShooter.CountAllocations.
+ * Results are logged by MyShooter.AllocationStats and checked by MyShooter.Performance.HotPathAllocations automation test.
+ */
+class MYSHOOTER_API FMSAllocationCounter
+{
+private:
+    struct FScopeStats
+    {
+        int32 NumCalls = 0;
+        int64 NumAllocations = 0;
+        int32 MaxAllocations = 0;
+    };
+
+    static bool bInstalled;
+    static bool bEnabled;
+    static FMSAllocationScope* CurrentScope;
+
+public:
+    // Wraps global allocator with counting proxy, which is never removed
+    static void Install();
+    static FORCEINLINE bool IsInstalled() { return bInstalled; }
+
+    static void SetEnabled(bool bInEnabled);
+    static FORCEINLINE bool IsEnabled() { return bEnabled; }
+
+    static void LogStats();
+    static void ResetStats();
+
+    // Returns false if scope wasn't entered while counting
+    static bool FindScopeStats(const TCHAR* Name, int32& OutNumCalls, int64& OutNumAllocations);
+
+private:
+    friend class FMSAllocationScope;
+    friend class FMSCountingMalloc;
+
+    static TMap<const TCHAR*, FScopeStats>& GetScopeStats();
+    static void OnAllocation();
+};
+
+class MYSHOOTER_API FMSAllocationScope
+{
+private:
+    const TCHAR* Name;
+    FMSAllocationScope* ParentScope = nullptr;
+    int32 NumAllocations = 0;
+    bool bActive = false;
+
+public:
+    explicit FMSAllocationScope(const TCHAR* InName);
+    ~FMSAllocationScope();
+
+private:
+    friend class FMSAllocationCounter;
+};
+
+// Counts heap allocations of enclosing scope, e.g. MS_SCOPE_ALLOCATION_COUNTER(RifleShot)
+#define MS_SCOPE_ALLOCATION_COUNTER(Name) FMSAllocationScope PREPROCESSOR_JOIN(AllocationScope_, __LINE__)(TEXT(#Name))
+
+#else
+
+#define MS_SCOPE_ALLOCATION_COUNTER(Name)
+
+#endif
@@ -0,0 +1,60 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "MSBenchmarkSubsystem.generated.h"
+
+struct FBenchmarkSettings
+{
+    int32 NumBots = 8;
+    int32 NumRounds = 1;
+    int32 RoundTime = 60;
+    int32 Seed = 0;
+    FString CSVPath;
+};
+
+/**
+ * Collects frame samples during headless bot soak run and appends summary row to CSV when it's finished.
+ * Usage: -MSBenchmark -Bots=64 -Rounds=3 -RoundTime=60 -Seed=1 [-BenchmarkCSV=Path]
+ */
+UCLASS()
+class MYSHOOTER_API UMSBenchmarkSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+private:
+    FBenchmarkSettings Settings;
+    bool bRunning = false;
+
+    TArray<float> FrameTimes;
+    TArray<float> GameThreadTimes;
+    int64 ActorCountSum = 0;
+    int32 MaxActorCount = 0;
+    int32 NumShotsFired = 0;
+    double StartTime = 0.0;
+
+    float RoundResetTimeSum = 0.0f;
+    float MaxRoundResetTime = 0.0f;
+    int32 NumRoundResets = 0;
+
+public:
+    static bool ParseCommandLine(FBenchmarkSettings& OutSettings);
+
+    void StartBenchmark(const FBenchmarkSettings& InSettings);
+    void FinishBenchmark();
+
+    FORCEINLINE bool IsRunning() const { return bRunning; }
+    FORCEINLINE void AddShot() { NumShotsFired += bRunning; }
+    void AddRoundReset(float ResetTime);
+
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override { return bRunning; }
+    virtual TStatId GetStatId() const override;
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+private:
+    void WriteCSV() const;
+};
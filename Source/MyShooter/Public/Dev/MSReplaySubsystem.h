@@ -0,0 +1,95 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "InputCoreTypes.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Dev/MSBenchmarkSubsystem.h"
+#include "MSReplaySubsystem.generated.h"
+
+/**
+ * Creates per weapon and per bot random streams from match seed, records local player input and frame times
+ * of benchmark match to compact binary file and replays it frame by frame, so builds can be compared on identical workload.
+ * Unlike plain benchmark, recorded and replayed matches spawn local player pawn, which is driven by recorded input.
+ * Usage: -MSBenchmark -Bots=64 -Seed=1 -MSRecord=Path to record, -MSBenchmark -MSReplay=Path to replay
+ */
+UCLASS()
+class MYSHOOTER_API UMSReplaySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+private:
+    enum class EReplayMode : uint8
+    {
+        None,
+        Recording,
+        Replaying
+    };
+
+    struct FInputRecord
+    {
+        uint16 KeyIndex = 0;
+        uint8 Flags = 0;
+        // Input event for keys, number of samples for axes
+        uint8 EventOrSamples = 0;
+        float Value = 0.0f;
+
+        friend FArchive& operator<<(FArchive& Ar, FInputRecord& Record)
+        {
+            return Ar << Record.KeyIndex << Record.Flags << Record.EventOrSamples << Record.Value;
+        }
+    };
+
+    struct FFrameRecord
+    {
+        float DeltaTime = 0.0f;
+        uint16 NumInputs = 0;
+    };
+
+    int32 MatchSeed = 0;
+    int32 NextStreamIndex = 0;
+
+    EReplayMode Mode = EReplayMode::None;
+    FString FilePath;
+    FBenchmarkSettings Settings;
+
+    TArray<FName> KeyNames;
+    TMap<FName, int32> KeyIndices;
+    TArray<FFrameRecord> Frames;
+    TArray<FInputRecord> Inputs;
+
+    int32 CurrentFrame = 0;
+    int32 NextInputIndex = 0;
+    bool bInjectingInput = false;
+
+    FDelegateHandle WorldTickStartHandle;
+
+public:
+    // Starts recording or replay from command line, replay overrides benchmark settings by recorded ones
+    void StartFromCommandLine(FBenchmarkSettings& InOutSettings);
+    void FinishRecording();
+
+    // Streams are created in the same order in recorded and replayed match, so they give the same numbers
+    void SetMatchSeed(int32 Seed);
+    FRandomStream MakeRandomStream();
+
+    FORCEINLINE bool IsRecording() const { return Mode == EReplayMode::Recording; }
+    FORCEINLINE bool IsReplaying() const { return Mode == EReplayMode::Replaying; }
+    FORCEINLINE bool IsInjectingInput() const { return bInjectingInput; }
+
+    void RecordKey(const FKey& Key, EInputEvent EventType, float AmountDepressed, bool bGamepad);
+    void RecordAxis(const FKey& Key, float Delta, int32 NumSamples, bool bGamepad);
+
+    virtual void Deinitialize() override;
+
+private:
+    bool LoadReplay(const FString& Path);
+    bool SaveReplay() const;
+
+    void AddInput(const FKey& Key, uint8 Flags, uint8 EventOrSamples, float Value);
+    void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+    void InjectFrameInput(const FFrameRecord& Frame, float DeltaTime);
+    void FinishReplay();
+};
@@ -4,9 +4,12 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/GameModeBase.h"
+#include "Dev/MSBenchmarkSubsystem.h"
 #include "MSGameModeBase.generated.h"
 
 class AAIController;
+class UMaterialInterface;
+class UMaterialInstanceDynamic;
 
 UCLASS()
 class MYSHOOTER_API AMSGameModeBase : public AGameModeBase
@@ -37,19 +40,36 @@ private:
     int32 RoundTimeLeft;
     FTimerHandle RoundTimer;
 
+    bool bBenchmarkMode = false;
+    FBenchmarkSettings BenchmarkSettings;
+
+    // Team materials are shared by all characters with the same base material and team color
+    UPROPERTY()
+    TArray<UMaterialInstanceDynamic*> TeamMaterials;
+
+    TMap<TPair<const UMaterialInterface*, FLinearColor>, UMaterialInstanceDynamic*> TeamMaterialCache;
+
 public:
     AMSGameModeBase();
 
+    virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
     virtual void StartPlay() override;
     UClass* GetDefaultPawnClassForController_Implementation(AController* InController);
+    virtual bool PlayerCanRestart_Implementation(APlayerController* Player) override;
 
 private:
     void SpawnBots();
     void SetTeamInfo();
     void SetCharacterColor(AController* Controller);
+    UMaterialInstanceDynamic* GetTeamMaterial(UMaterialInterface* BaseMaterial, const FLinearColor& Color, FName ColorParameterName);
 
     void StartRound();
     void ResetPlayers();
+    bool ResetPlayerInPlace(AController* Controller);
 
     void OnRoundUpdate();
+
+    bool CanRestartController(AController* Controller) const;
+    UMSBenchmarkSubsystem* GetBenchmarkSubsystem() const;
+    void FinishBenchmark();
 };
@@ -23,23 +23,24 @@ protected:
 private:
     float RotationYaw;
 
-    FTimerHandle RespawnTimer;
+    bool bTaken = false;
 
 public:
     AMSPickup();
 
-    virtual void Tick(float DeltaTime) override;
+    bool CanBeTaken() const { return !bTaken; }
 
-    bool CanBeTaken() const { return !GetWorldTimerManager().IsTimerActive(RespawnTimer); }
+    void Respawn();
+    void UpdateRotation(float DeltaTime);
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(EEndPlayReason::Type Reason) override;
     virtual void NotifyActorBeginOverlap(AActor* OtherActor) override;
 
 private:
     virtual bool GivePickupTo(APawn* Pawn);
 
     void Hide();
-    void Respawn();
     FORCEINLINE void GenerateRotation() { RotationYaw = FMath::RandRange(100.0f, 200.0f) * (FMath::RandBool() ? 1.0f : -1.0f); }
 };
@@ -0,0 +1,101 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "MSPickupSubsystem.generated.h"
+
+class AMSPickup;
+
+/**
+ * Drives all pickups of the world so pickup actors don't tick. Respawns are scheduled
+ * on a single time wheel, rotation is applied only to pickups that were recently rendered.
+ * Availability of pickups is kept per pickup class as bitset for AI queries.
+ */
+UCLASS(Config = Game)
+class MYSHOOTER_API UMSPickupSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+protected:
+    UPROPERTY(Config)
+    float WheelSlotTime = 0.25f;
+
+    UPROPERTY(Config)
+    int32 NumWheelSlots = 64;
+
+private:
+    struct FRespawnEntry
+    {
+        TWeakObjectPtr<AMSPickup> Pickup;
+        int32 Rounds;
+    };
+
+    struct FPickupType
+    {
+        const UClass* Class = nullptr;
+        TArray<TWeakObjectPtr<AMSPickup>> Pickups;
+        TBitArray<> Available;
+    };
+
+    struct FPickupLocation
+    {
+        int32 TypeIndex;
+        int32 Index;
+    };
+
+    TArray<FPickupType> PickupTypes;
+    TMap<const AMSPickup*, FPickupLocation> PickupLocations;
+
+    TArray<TArray<FRespawnEntry>> Wheel;
+    int32 WheelCursor = 0;
+    float WheelAccumulator = 0.0f;
+    int32 NumScheduled = 0;
+
+public:
+    void AddPickup(AMSPickup* Pickup);
+    void RemovePickup(AMSPickup* Pickup);
+
+    void ScheduleRespawn(AMSPickup* Pickup, float Delay);
+
+    // Calls Visitor for each available pickup of PickupClass or its child class
+    template<typename VisitorType>
+    void ForEachAvailablePickup(const UClass* PickupClass, VisitorType&& Visitor) const;
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override;
+    virtual TStatId GetStatId() const override;
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+private:
+    void AdvanceWheel(float DeltaTime);
+    void RespawnSlot(int32 SlotIndex);
+    void RotatePickups(float DeltaTime);
+
+    void SetAvailable(const AMSPickup* Pickup, bool bAvailable);
+};
+
+template<typename VisitorType>
+void UMSPickupSubsystem::ForEachAvailablePickup(const UClass* PickupClass, VisitorType&& Visitor) const
+{
+    for (const FPickupType& PickupType : PickupTypes)
+    {
+        if (PickupClass && !PickupType.Class->IsChildOf(PickupClass))
+        {
+            continue;
+        }
+
+        for (TConstSetBitIterator<> It(PickupType.Available); It; ++It)
+        {
+            if (AMSPickup* Pickup = PickupType.Pickups[It.GetIndex()].Get())
+            {
+                Visitor(Pickup);
+            }
+        }
+    }
+}
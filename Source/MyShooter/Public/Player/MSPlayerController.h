@@ -6,8 +6,21 @@
 #include "GameFramework/PlayerController.h"
 #include "MSPlayerController.generated.h"
 
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPawnChangedSignature, APawn*);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnControllerStateChangedSignature, FName);
+
 UCLASS()
 class MYSHOOTER_API AMSPlayerController : public APlayerController
 {
     GENERATED_BODY()
+
+public:
+    FOnPawnChangedSignature OnPawnChanged;
+    FOnControllerStateChangedSignature OnStateChanged;
+
+    virtual void SetPawn(APawn* InPawn) override;
+    virtual void ChangeState(FName NewState) override;
+
+    virtual bool InputKey(FKey Key, EInputEvent EventType, float AmountDepressed, bool bGamepad) override;
+    virtual bool InputAxis(FKey Key, float Delta, float DeltaTime, int32 NumSamples, bool bGamepad) override;
 };
@@ -0,0 +1,79 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Weapon/MSWeapon.h"
+#include "MSPlayerHUDViewModel.generated.h"
+
+class AMSPlayerController;
+class UMSHealthComponent;
+class UMSWeaponComponent;
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnHUDHealthChangedSignature, float, float);
+DECLARE_MULTICAST_DELEGATE(FOnHUDWeaponChangedSignature);
+DECLARE_MULTICAST_DELEGATE(FOnHUDAmmoChangedSignature);
+DECLARE_MULTICAST_DELEGATE(FOnHUDPlayerStateChangedSignature);
+
+/**
+ * Caches HUD data of the owning player. Listens to player controller and player components
+ * and notifies HUD only when something has changed, so HUD doesn't poll components every frame.
+ */
+UCLASS()
+class MYSHOOTER_API UMSPlayerHUDViewModel : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    FOnHUDHealthChangedSignature OnHealthChanged;
+    FOnHUDWeaponChangedSignature OnWeaponChanged;
+    FOnHUDAmmoChangedSignature OnAmmoChanged;
+    FOnHUDPlayerStateChangedSignature OnPlayerStateChanged;
+
+private:
+    UPROPERTY()
+    AMSPlayerController* PlayerController = nullptr;
+
+    TWeakObjectPtr<APawn> Pawn;
+    TWeakObjectPtr<UMSHealthComponent> HealthComponent;
+    TWeakObjectPtr<UMSWeaponComponent> WeaponComponent;
+
+    float HealthPercent = 0.0f;
+
+    bool bHasWeapon = false;
+    FWeaponUIData WeaponUIData;
+    FAmmoData CurrentAmmo;
+    FAmmoData DefaultAmmo;
+
+    bool bPlayerAlive = false;
+    bool bPlayerSpectating = false;
+
+public:
+    void Initialize(AMSPlayerController* InPlayerController);
+    void Deinitialize();
+
+    FORCEINLINE float GetHealthPercent() const { return HealthPercent; }
+    FORCEINLINE bool HasWeapon() const { return bHasWeapon; }
+    FORCEINLINE const FWeaponUIData& GetWeaponUIData() const { return WeaponUIData; }
+    FORCEINLINE const FAmmoData& GetCurrentAmmo() const { return CurrentAmmo; }
+    FORCEINLINE const FAmmoData& GetDefaultAmmo() const { return DefaultAmmo; }
+    FORCEINLINE bool IsPlayerAlive() const { return bPlayerAlive; }
+    FORCEINLINE bool IsPlayerSpectating() const { return bPlayerSpectating; }
+
+private:
+    void BindPawn(APawn* InPawn);
+    void UnbindPawn();
+
+    void OnPawnChanged(APawn* InPawn);
+    void OnControllerStateChanged(FName StateName);
+    void OnPlayerHealthChanged(float Health, float DeltaHealth);
+    void OnPlayerDeath();
+    void OnPlayerWeaponChanged(AMSWeapon* Weapon);
+    void OnPlayerAmmoChanged(AMSWeapon* Weapon);
+
+    void UpdateHealth(float DeltaHealth);
+    void UpdateWeapon();
+    void UpdateAmmo();
+    void UpdatePlayerState();
+};
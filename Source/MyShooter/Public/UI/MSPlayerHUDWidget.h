@@ -5,14 +5,25 @@
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
 #include "Weapon/MSWeapon.h"
-#include "Core/CoreUtils.h"
 #include "MSPlayerHUDWidget.generated.h"
 
+class UMSPlayerHUDViewModel;
+class UInvalidationBox;
+
 UCLASS()
 class MYSHOOTER_API UMSPlayerHUDWidget : public UUserWidget
 {
     GENERATED_BODY()
 
+protected:
+    // Optional root of HUD, cached and repainted only when view model pushes changes.
+    // WBP_PlayerHUD doesn't have it yet and still polls getters below through property bindings.
+    UPROPERTY(meta = (BindWidgetOptional))
+    UInvalidationBox* HUDInvalidationBox;
+
+    UPROPERTY(BlueprintReadOnly, Category = "UI")
+    UMSPlayerHUDViewModel* ViewModel;
+
 protected:
     UFUNCTION(BlueprintCallable, Category = "UI")
     float GetHealthPercent() const;
@@ -29,17 +40,27 @@ protected:
     UFUNCTION(BlueprintCallable, Category = "UI")
     bool IsPlayerSpectating() const;
 
-    virtual bool Initialize() override;
+    virtual void NativeConstruct() override;
+    virtual void NativeDestruct() override;
 
     UFUNCTION(BlueprintImplementableEvent, Category = "UI")
     void OnDamageTaken();
 
-private:
-    template<typename T>
-    FORCEINLINE T* GetPlayerComponent() const
-    {
-        return FCoreUtils::GetActorComponent<T>(GetOwningPlayerPawn());
-    }
+    UFUNCTION(BlueprintImplementableEvent, Category = "UI")
+    void OnHealthUpdated(float HealthPercent);
 
-    void OnHealthChanged(float Health, float DeltaHealth);
+    UFUNCTION(BlueprintImplementableEvent, Category = "UI")
+    void OnWeaponUpdated(bool bHasWeapon, const FWeaponUIData& UIData);
+
+    UFUNCTION(BlueprintImplementableEvent, Category = "UI")
+    void OnAmmoUpdated(const FAmmoData& CurrentAmmo, const FAmmoData& DefaultAmmo);
+
+    UFUNCTION(BlueprintImplementableEvent, Category = "UI")
+    void OnPlayerStateUpdated(bool bAlive, bool bSpectating);
+
+private:
+    void OnHealthChanged(float HealthPercent, float DeltaHealth);
+    void OnWeaponChanged();
+    void OnAmmoChanged();
+    void OnPlayerStateChanged();
 };
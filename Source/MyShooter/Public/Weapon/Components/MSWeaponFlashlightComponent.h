@@ -4,10 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "Components/SpotLightComponent.h"
+#include "Weapon/MSWeaponAccessory.h"
 #include "MSWeaponFlashlightComponent.generated.h"
 
 UCLASS()
-class MYSHOOTER_API UMSWeaponFlashlightComponent : public USpotLightComponent
+class MYSHOOTER_API UMSWeaponFlashlightComponent : public USpotLightComponent, public IMSWeaponAccessory
 {
     GENERATED_BODY()
 
@@ -18,8 +19,13 @@ public:
     FORCEINLINE void Toggle() { SetState(!bEnabled); }
     FORCEINLINE void Toggle(bool bInEnabled) { SetState(bInEnabled); }
 
-    void OnEquipped() { SetVisibility(bEnabled, true); }
-    void OnUnequipped() { SetVisibility(false, true); }
+    virtual EMSWeaponAccessorySlot GetAccessorySlot() const override { return EMSWeaponAccessorySlot::Flashlight; }
+
+    virtual void ToggleAccessory() override { Toggle(); }
+
+    virtual void OnWeaponEquipped() override { SetVisibility(bEnabled, true); }
+    virtual void OnWeaponUnequipped() override { SetVisibility(false, true); }
+    virtual void OnWeaponPoolDeactivated() override { Toggle(false); }
 
 protected:
     virtual void BeginPlay() override;
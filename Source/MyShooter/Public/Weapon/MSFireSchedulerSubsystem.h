@@ -0,0 +1,59 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "MSFireSchedulerSubsystem.generated.h"
+
+class AMSRifleWeapon;
+
+/**
+ * Fires all automatic weapons at fixed rate in one batched pass per frame. Each weapon accumulates frame time
+ * and fires every shot it owes with its sub-frame time, so fire rate doesn't depend on frame rate
+ */
+UCLASS(Config = Game)
+class MYSHOOTER_API UMSFireSchedulerSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+protected:
+    // Limits catch up shots of one weapon after long hitches
+    UPROPERTY(Config)
+    int32 MaxShotsPerFrame = 8;
+
+private:
+    struct FFiringWeapon
+    {
+        TWeakObjectPtr<AMSRifleWeapon> Weapon;
+        float TimeBetweenShots = 0.1f;
+        float Accumulator = 0.0f;
+        bool bJustStarted = true;
+    };
+
+    struct FDueShot
+    {
+        int32 FiringIndex = INDEX_NONE;
+        float ShotTime = 0.0f;
+    };
+
+    TArray<FFiringWeapon> FiringWeapons;
+    TArray<FDueShot> DueShots;
+
+public:
+    // Weapon fires its first shot by itself, scheduler fires the next ones
+    void StartFiring(AMSRifleWeapon* Weapon, float TimeBetweenShots);
+    void StopFiring(AMSRifleWeapon* Weapon);
+    bool IsFiring(const AMSRifleWeapon* Weapon) const { return FindFiringIndex(Weapon) != INDEX_NONE; }
+
+    virtual void Deinitialize() override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override;
+    virtual TStatId GetStatId() const override;
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+private:
+    int32 FindFiringIndex(const AMSRifleWeapon* Weapon) const;
+};
@@ -0,0 +1,52 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "WorldCollision.h"
+#include "Weapon/MSWeapon.h"
+#include "MSHitscanSubsystem.generated.h"
+
+class AMSRifleWeapon;
+
+/**
+ * Collects hitscan shots during the frame, sends all traces together as async traces
+ * and resolves damage and FX of the whole batch in one pass on the next frame
+ */
+UCLASS()
+class MYSHOOTER_API UMSHitscanSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+private:
+    struct FShotRequest
+    {
+        TWeakObjectPtr<AMSRifleWeapon> Weapon;
+        FShotContext ShotContext;
+        FTraceHandle TraceHandle;
+    };
+
+    TArray<FShotRequest> QueuedShots;
+    TArray<FShotRequest> InFlightShots;
+
+    // Reused by every resolved shot, so queried trace results keep their allocation
+    FTraceDatum TraceDatum;
+
+public:
+    void QueueShot(AMSRifleWeapon* Weapon, const FShotContext& ShotContext);
+
+    virtual void Deinitialize() override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override;
+    virtual TStatId GetStatId() const override;
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+private:
+    void ResolveShots();
+    void DispatchShots();
+
+    static FCollisionQueryParams MakeCollisionParams(const AMSRifleWeapon& Weapon);
+};
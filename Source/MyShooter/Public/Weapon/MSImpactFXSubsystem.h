@@ -0,0 +1,87 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "Components/MSWeaponFXComponent.h"
+#include "MSImpactFXSubsystem.generated.h"
+
+class UDecalComponent;
+
+struct FImpactFXStats
+{
+    int32 NumLiveDecals = 0;
+    int32 NumRequested = 0;
+    int32 NumSpawned = 0;
+    int32 NumDroppedByBudget = 0;
+    int32 NumDroppedByDistance = 0;
+};
+
+/**
+ * Spawns impact FX with per frame budget. Decals are reused from fixed size ring buffer,
+ * niagara effects are taken from niagara component pool.
+ */
+UCLASS(Config = Game)
+class MYSHOOTER_API UMSImpactFXSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+protected:
+    UPROPERTY(Config)
+    int32 MaxDecals = 128;
+
+    UPROPERTY(Config)
+    int32 MaxImpactsPerFrame = 16;
+
+    UPROPERTY(Config)
+    float MaxImpactDistance = 6000.0f;
+
+private:
+    struct FImpactRequest
+    {
+        UNiagaraSystem* NiagaraEffect;
+        FDecalData DecalData;
+        FVector Location;
+        FRotator Rotation;
+        TWeakObjectPtr<USceneComponent> AttachComponent;
+        FName BoneName;
+        bool bHighPriority;
+        float DistanceSquared;
+    };
+
+    UPROPERTY()
+    TArray<UDecalComponent*> Decals;
+
+    TArray<float> DecalExpireTimes;
+    int32 NextDecalIndex = 0;
+
+    TArray<FImpactRequest> PendingImpacts;
+
+    FVector ViewLocation = FVector::ZeroVector;
+    bool bHasViewLocation = false;
+    uint64 ViewLocationFrame = 0;
+
+    FImpactFXStats Stats;
+
+public:
+    void QueueImpact(const FImpactData& ImpactData, const FHitResult& HitResult);
+
+    const FImpactFXStats& GetStats() const { return Stats; }
+    void LogStats() const;
+
+    virtual void Deinitialize() override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override;
+    virtual TStatId GetStatId() const override;
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+private:
+    void UpdateViewLocation();
+    void ExpireDecals();
+
+    void SpawnImpact(const FImpactRequest& Request);
+    UDecalComponent* GetNextDecal(int32& DecalIndex);
+};
@@ -17,9 +17,14 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Weapon")
     TSubclassOf<AMSProjectile> ProjectileClass;
 
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Weapon", meta = (ClampMin = "0"))
+    int32 ProjectilePoolSize = 4;
+
 public:
     virtual void StartFire() override;
 
 protected:
+    virtual void BeginPlay() override;
+
     virtual void MakeShot() override;
 };
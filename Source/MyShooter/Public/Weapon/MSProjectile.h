@@ -4,14 +4,16 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Core/MSPoolableActor.h"
 #include "MSProjectile.generated.h"
 
 class USphereComponent;
 class UProjectileMovementComponent;
 class UMSWeaponFXComponent;
+class UCurveFloat;
 
 UCLASS()
-class MYSHOOTER_API AMSProjectile : public AActor
+class MYSHOOTER_API AMSProjectile : public AActor, public IMSPoolableActor
 {
     GENERATED_BODY()
 
@@ -34,17 +36,26 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Weapon")
     bool bDoFullDamage = false;
 
+    // Damage scale by distance normalized by damage radius, linear falloff is used if it's not set
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Weapon", meta = (EditCondition = "!bDoFullDamage"))
+    UCurveFloat* DamageFalloffCurve;
+
     UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Weapon")
     float LifeSeconds = 5.0f;
 
 private:
     FVector ShotDirection;
 
+    FTimerHandle LifeTimer;
+
 public:
     AMSProjectile();
 
     void SetShotDirection(const FVector& Direction) { ShotDirection = Direction; }
 
+    virtual void OnPoolActivated() override;
+    virtual void OnPoolDeactivated() override;
+
 protected:
     virtual void BeginPlay() override;
 
@@ -53,4 +64,6 @@ private:
     void OnProjectileHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit);
 
     AController* GetController() const;
+
+    void ReturnToPool();
 };
@@ -0,0 +1,74 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "WorldCollision.h"
+#include "GameFramework/DamageType.h"
+#include "MSRadialDamageSubsystem.generated.h"
+
+class UCurveFloat;
+class APawn;
+
+struct FMSRadialDamageParams
+{
+    float BaseDamage = 0.0f;
+    FVector Origin = FVector::ZeroVector;
+    float Radius = 0.0f;
+
+    // Maps distance normalized by radius to damage scale, linear falloff is used without it
+    const UCurveFloat* FalloffCurve = nullptr;
+    bool bDoFullDamage = false;
+
+    TSubclassOf<UDamageType> DamageType;
+    TWeakObjectPtr<AActor> DamageCauser;
+    TWeakObjectPtr<AController> Instigator;
+    TWeakObjectPtr<AActor> IgnoredActor;
+};
+
+/**
+ * Radial damage of all explosions in the frame. Candidates are taken from combatant grid, occlusion of the whole batch
+ * is checked with async traces and damage is applied in one pass on the next frame
+ */
+UCLASS()
+class MYSHOOTER_API UMSRadialDamageSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+private:
+    struct FDamageTarget
+    {
+        int32 RequestIndex = INDEX_NONE;
+        TWeakObjectPtr<APawn> Pawn;
+        FVector Location = FVector::ZeroVector;
+        float Damage = 0.0f;
+        FTraceHandle TraceHandle;
+    };
+
+    TArray<FMSRadialDamageParams> QueuedRequests;
+    TArray<FMSRadialDamageParams> InFlightRequests;
+    TArray<FDamageTarget> InFlightTargets;
+
+    // Reused by every damaged target, so trace results and component hits keep their allocations
+    FTraceDatum TraceDatum;
+    FRadialDamageEvent DamageEvent;
+
+public:
+    void ApplyRadialDamage(const FMSRadialDamageParams& Params);
+
+    virtual void Deinitialize() override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override;
+    virtual TStatId GetStatId() const override;
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+private:
+    void ResolveTargets();
+    void DispatchRequests();
+
+    static FCollisionQueryParams MakeOcclusionParams(const FMSRadialDamageParams& Params, const APawn* Pawn);
+    static float GetDamageScale(const FMSRadialDamageParams& Params, float Distance);
+};
@@ -38,8 +38,6 @@ protected:
     FString TraceTargetName = "TraceTarget";
 
 private:
-    FTimerHandle ShotTimer;
-
     UNiagaraComponent* MuzzleFXComponent;
 
 public:
@@ -48,15 +46,16 @@ public:
     virtual void StartFire() override;
     virtual void StopFire() override;
 
-    virtual void OnEquipped() override;
-    virtual void OnUnequipped() override;
+    // Called by fire scheduler with sub-frame time of the shot
+    void MakeScheduledShot(float ShotTime);
+    void ResolveShot(const FShotContext& ShotContext, const FHitResult& HitResult);
 
 protected:
     virtual void BeginPlay() override;
 
-    void MakeDamage(FHitResult& HitResult);
+    void MakeDamage(const FHitResult& HitResult);
     virtual void MakeShot() override;
-    virtual bool GetTraceData(FVector& TraceStart, FVector& TraceEnd) const override;
+    virtual bool GetTraceData(FShotContext& ShotContext) const override;
 
     void ToggleMuzzleFXVisibility(bool bVisible);
     void SpawnTraceFX(const FVector& TraceStart, const FVector& TraceEnd);
@@ -4,14 +4,26 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Core/MSPoolableActor.h"
+#include "Weapon/MSWeaponAccessory.h"
 #include "MSWeapon.generated.h"
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnClipEmptySignature, AMSWeapon*);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnAmmoChangedSignature, AMSWeapon*);
 
 class USkeletalMeshComponent;
 class UNiagaraSystem;
 class UNiagaraComponent;
 
+struct FShotContext
+{
+    FTransform MuzzleTransform;
+    FVector ViewLocation;
+    FRotator ViewRotation;
+    FVector TraceStart;
+    FVector TraceEnd;
+};
+
 USTRUCT(BlueprintType)
 struct FAmmoData
 {
@@ -40,12 +52,13 @@ struct FWeaponUIData
 };
 
 UCLASS()
-class MYSHOOTER_API AMSWeapon : public AActor
+class MYSHOOTER_API AMSWeapon : public AActor, public IMSPoolableActor
 {
     GENERATED_BODY()
 
 public:
     FOnClipEmptySignature OnClipEmpty;
+    FOnAmmoChangedSignature OnAmmoChanged;
 
 protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Components")
@@ -66,20 +79,36 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "VFX")
     UNiagaraSystem* MuzzleFX;
 
+    // Seeded from match seed, so recorded matches are replayed with the same spread
+    FRandomStream RandomStream;
+
 private:
     FAmmoData CurrentAmmo;
 
+    struct FAccessorySlot
+    {
+        UActorComponent* Component = nullptr;
+        IMSWeaponAccessory* Accessory = nullptr;
+    };
+
+    // Resolved once on spawn, indexed by accessory slot
+    FAccessorySlot AccessorySlots[static_cast<int32>(EMSWeaponAccessorySlot::Num)];
+
 public:
     AMSWeapon();
 
     virtual void StartFire() {}
     virtual void StopFire() {}
 
-    virtual void OnEquipped() {}
-    virtual void OnUnequipped() {}
+    virtual void OnEquipped();
+    virtual void OnUnequipped();
+
+    virtual void OnPoolActivated() override;
+    virtual void OnPoolDeactivated() override;
 
     void ChangeClip();
     bool TryToAddAmmo(int32 Clips);
+    void ResetAmmo();
 
     FORCEINLINE bool CanReload() const { return CurrentAmmo.Bullets < DefaultAmmo.Bullets && CurrentAmmo.Clips > 0; }
     FORCEINLINE bool IsAmmoEmpty() const { return !CurrentAmmo.bInfinite && CurrentAmmo.Clips <= 0 && IsClipEmpty(); }
@@ -87,6 +116,17 @@ public:
     FORCEINLINE bool IsAmmoFull() const { return CurrentAmmo.Bullets == DefaultAmmo.Bullets && CurrentAmmo.Clips == DefaultAmmo.Clips; };
 
     const FWeaponUIData& GetUIData() const { return UIData; }
+
+    FORCEINLINE IMSWeaponAccessory* GetAccessory(EMSWeaponAccessorySlot Slot) const
+    {
+        return AccessorySlots[static_cast<int32>(Slot)].Accessory;
+    }
+
+    template<typename T>
+    FORCEINLINE T* GetAccessory(EMSWeaponAccessorySlot Slot) const
+    {
+        return Cast<T>(AccessorySlots[static_cast<int32>(Slot)].Component);
+    }
     void GetAmmoData(FAmmoData& InCurrentAmmo, FAmmoData& InDefaultAmmo) const;
 
 protected:
@@ -94,13 +134,16 @@ protected:
 
     virtual void MakeShot() {}
     bool MakeHit(FHitResult& HitResult, const FVector& TraceStart, const FVector& TraceEnd) const;
-    virtual bool GetTraceData(FVector& TraceStart, FVector& TraceEnd) const;
+    bool MakeShotContext(FShotContext& ShotContext) const;
+    virtual bool GetTraceData(FShotContext& ShotContext) const;
 
     void DecreaseAmmo();
 
+    void InitAccessories();
+
     UNiagaraComponent* SpawnMuzzleFX();
 
     AController* GetPlayerController() const;
-    bool GetPlayerViewPoint(FVector& ViewLocation, FRotator& ViewRotation) const;
+    bool GetPlayerViewPoint(const FTransform& MuzzleTransform, FVector& ViewLocation, FRotator& ViewRotation) const;
     FORCEINLINE FTransform GetMuzzleTransform() const { return WeaponMesh->GetSocketTransform(MuzzleSocketName); }
 };
@@ -0,0 +1,39 @@
+// MyShooter Game, All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "MSWeaponAccessory.generated.h"
+
+enum class EMSWeaponAccessorySlot : uint8
+{
+    Scope,
+    Flashlight,
+    Suppressor,
+
+    Num
+};
+
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UMSWeaponAccessory : public UInterface
+{
+    GENERATED_BODY()
+};
+
+// Weapon component which takes one of weapon accessory slots, weapon resolves its slots once on spawn
+class MYSHOOTER_API IMSWeaponAccessory
+{
+    GENERATED_BODY()
+
+public:
+    virtual EMSWeaponAccessorySlot GetAccessorySlot() const = 0;
+
+    virtual void ToggleAccessory() {}
+
+    virtual void OnWeaponEquipped() {}
+    virtual void OnWeaponUnequipped() {}
+
+    // Called when weapon is returned to pool, accessory should be reset here
+    virtual void OnWeaponPoolDeactivated() {}
+};